@@ -1,21 +1,146 @@
 #ifndef BAKALARSKAPRACA_ALGORITHMS_H
 #define BAKALARSKAPRACA_ALGORITHMS_H
 
+#include <algorithm>
+#include <bit>
 #include <chrono>
 #include <cmath>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <type_traits>
+#include <vector>
+#include "BandMatrix.h"
+#include "BigInteger.h"
 #include "Matrix.h"
+#include "MatrixView.h"
+#include "Modular.h"
+#include "ScratchArena.h"
+#include "SimdKernels.h"
+#include "SparseMatrix.h"
+#include "StaticMatrix.h"
+#include "StructuralAnalysis.h"
+#include "TaskScheduler.h"
+#include "ThreadPool.h"
 
 /**
  * Enum laplaceVariant, ktorý reprezentuje varianty Laplaceovho rozvoja.
  */
-enum laplaceVariant { FULL_LAPLACE_EXPANSION, LAPLACE_RULE_OF_SARRUS };
+enum laplaceVariant { FULL_LAPLACE_EXPANSION, LAPLACE_RULE_OF_SARRUS, LAPLACE_SUBSET_DP };
+
+/**
+ * Enum matrixStructure, ktorý reprezentuje rozloženie nenulových prvkov matice so špeciálnym výpočtom determinantu.
+ */
+enum matrixStructure { GENERAL_MATRIX, DIAGONAL_MATRIX, UPPER_TRIANGULAR_MATRIX, LOWER_TRIANGULAR_MATRIX, TRIDIAGONAL_MATRIX, UPPER_HESSENBERG_MATRIX, LOWER_HESSENBERG_MATRIX };
+
+/**
+ * Štruktúra bareissState uchováva stav Bareissovho algoritmu, aby bolo možné po pretečení pokračovať v širšom type.
+ */
+struct bareissState {
+    int step;           // aktuálny krok eliminácie (index pivota)
+    int row;            // prvý riadok, ktorý ešte nebol v aktuálnom kroku upravený
+    int sign;           // znamienko determinantu podľa výmen riadkov
+    bool singular;      // či sa nenašiel nenulový pivot (determinant je 0)
+};
+
+/**
+ * Štruktúra laplaceNode reprezentuje uzol stromu paralelného Laplaceovho rozvoja (jeden minor).
+ * Uzly do hĺbky rozvoja sa rozvíjajú ako samostatné úlohy, hlbšie podstromy sa počítajú sériovo.
+ * Uzol je triviálne kopírovateľný, potomkovia aj indexy minorov ležia v arene uzlov.
+ *
+ * @tparam T dátový typ prvkov matice
+ */
+template<typename T>
+struct laplaceNode {
+    int* indices;                           // indexy riadkov (prvých size) a stĺpcov (ďalších size) minoru
+    int size;                               // stupeň minoru
+    T element;                              // prvok, ktorým sa minor násobí v rozvoji rodiča
+    int signExponent;                       // súčet indexov riadku a stĺpca prvku v rodičovi (znamienko (-1)^signExponent)
+    bool expanded;                          // či bol uzol rozvinutý na potomkov (inak je hodnota v value)
+    T value;                                // determinant minoru vypočítaný sériovo
+    laplaceNode<T>* children;               // minory pre nenulové prvky rozvíjaného riadku (stĺpca) v poradí indexov
+    int childCount;                         // počet potomkov
+};
+
+/**
+ * Štruktúra sarrusLeaves predstavuje zásobník listov Laplaceovho rozvoja so Sarusovým pravidlom (minorov stupňa 3).
+ * Minory sa ukladajú po zložkách, aby ich determinanty mohlo naraz vypočítať vektorizované jadro.
+ *
+ * @tparam T dátový typ prvkov matice
+ */
+template<typename T>
+struct sarrusLeaves {
+    T* elements;        // prvky minorov po zložkách (prvok e minoru m je na indexe e * capacity + m)
+    T* coefficients;    // koeficienty minorov (súčin prvkov so znamienkami na ceste od koreňa rozvoja)
+    T* determinants;    // determinanty minorov vypočítané vektorizovaným jadrom
+    int capacity;       // kapacita zásobníka (počet minorov)
+    int count;          // počet minorov v zásobníku
+    T sum;              // súčet už vyhodnotených minorov vynásobených koeficientmi
+};
+
+/**
+ * Štruktúra sparseEntry predstavuje nenulový prvok riadku riedkej matice počas riedkeho LU rozkladu.
+ *
+ * @tparam T dátový typ prvkov matice
+ */
+template<typename T>
+struct sparseEntry {
+    int column;     // stĺpec prvku
+    T value;        // hodnota prvku
+};
+
+/**
+ * Štruktúra scaledValue uchováva číslo v tvare mantissa * 2^exponent, aby súčin veľkého počtu pivotov nepretiekol.
+ */
+struct scaledValue {
+    double mantissa;        // mantisa (0 alebo absolútna hodnota v intervale [0.5, 1))
+    long long exponent;     // dvojkový exponent
+};
 
 /**
  * Trieda Algorithms obsahuje jednotlivé algoritmy na výpočet determinantu štvorcových matíc.
+ * Pomocnú pamäť algoritmy berú z areny aktuálneho vlákna (ScratchArena), ktorá sa vynuluje na začiatku každého výpočtu.
  *
  */
 class Algorithms {
+private:
+    static constexpr int STABLE_PRIMES = 3;         // počet prvočísel, po ktorých sa výsledok CRT nezmenil, na predčasné ukončenie
+    static constexpr int PRIMES_PER_THREAD = 2;     // počet prvočísel na vlákno v jednej dávke multimodulárnej metódy
+    static constexpr int STATIC_DETERMINANT_MAX_SIZE = 8;   // najväčší stupeň matice, ktorej determinant Gauss a LU počítajú rozvinutým jadrom (StaticMatrix)
+    static constexpr int LEIBNIZ_CHUNKS = 1024;     // minimálny počet úsekov permutácií paralelnej Leibnitzovej metódy
+    static constexpr int LAPLACE_LEAF_BATCH = 256;  // kapacita zásobníka listov Laplaceovho rozvoja so Sarusovým pravidlom
+    static constexpr double LAPLACE_DP_MEMORY_LIMIT = 1 << 30;     // maximálna veľkosť tabuliek minorov Laplaceovho rozvoja s podmnožinami (v bajtoch)
+    static constexpr double SPARSE_DENSITY_THRESHOLD = 0.1;     // hustota, pod ktorou LU dekompozícia prevedie hustú maticu na riedku
+    static constexpr double SPARSE_DENSE_SWITCH = 0.25;        // hustota zvyšnej podmatice, od ktorej riedky LU rozklad pokračuje husto
+    static constexpr int MARKOWITZ_COLUMNS = 4;                 // počet stĺpcov s najmenej prvkami, v ktorých sa hľadá pivot
+    static constexpr double MARKOWITZ_PIVOT_THRESHOLD = 0.1;    // najmenší podiel pivota a najväčšieho prvku jeho stĺpca (prahová pivotizácia)
+
+    std::size_t peakScratchBytes_;      // maximum pomocnej pamäte (v bajtoch) použitej posledným výpočtom
+    std::vector<std::size_t> threadPeakBytes_;  // maximum pomocnej pamäte úloh každého vlákna posledného paralelného výpočtu
+    int luBlockSize_;                   // šírka bloku stĺpcov pre blokovú LU dekompozíciu
+    int threadCount_;                   // počet vlákien paralelných algoritmov
+    int parallelCutoff_;                // veľkosť podmatice, pod ktorou paralelné algoritmy pokračujú sériovo
+    int laplaceSpawnDepth_;             // hĺbka rozvoja, do ktorej paralelný Laplaceov rozvoj vytvára úlohy
+    int hybridCutoff_;                  // stupeň minoru, od ktorého hybridný Laplaceov rozvoj pokračuje LU rozkladom
+    double lastDeterminant_;            // determinant vypočítaný posledným výpočtom (približne, ak bol presný)
+    BigInteger lastExactDeterminant_;   // presný determinant posledného výpočtu (iba ak lastResultExact_)
+    bool lastResultExact_;              // či posledný výpočet dal presný celočíselný výsledok
+    std::unique_ptr<ThreadPool> threadPool_;    // perzistentný pool vlákien (vytvorí sa pri prvom použití)
+    std::unique_ptr<WorkStealingScheduler> taskScheduler_;     // plánovač grafov úloh (vytvorí sa pri prvom použití)
+
+    enum laplaceTaskType { LAPLACE_EXPANSION_TASK, LAPLACE_SUBTREE_TASK };     // typy úloh paralelného Laplaceovho rozvoja
 public:
+    static constexpr int DEFAULT_LU_BLOCK_SIZE = 64;    // predvolená šírka bloku pre blokovú LU dekompozíciu
+    static constexpr int DEFAULT_PARALLEL_CUTOFF = 64;  // predvolená veľkosť podmatice pre prechod na sériový výpočet
+    static constexpr int DEFAULT_LAPLACE_SPAWN_DEPTH = 3;   // predvolená hĺbka rozvoja, do ktorej paralelný Laplaceov rozvoj vytvára úlohy
+    static constexpr int DEFAULT_HYBRID_CUTOFF = 8;         // predvolený stupeň minoru, od ktorého hybridný Laplaceov rozvoj pokračuje LU rozkladom
+
+    /**
+     * Default konštruktor triedy.
+     */
+    Algorithms() : peakScratchBytes_(0), luBlockSize_(DEFAULT_LU_BLOCK_SIZE), threadCount_(getDefaultThreadCount()), parallelCutoff_(DEFAULT_PARALLEL_CUTOFF), laplaceSpawnDepth_(DEFAULT_LAPLACE_SPAWN_DEPTH), hybridCutoff_(DEFAULT_HYBRID_CUTOFF), lastDeterminant_(0), lastResultExact_(false) {};
+
     /**
      * Metóda gaussEliminationMethod reprezentuje algoritmus Gaussovej eliminácie na výpočet determinantu štvorcovej matice.
      *
@@ -27,64 +152,47 @@ public:
     template <typename T>
     double gaussEliminationMethod(Matrix<T>& matrix, bool characterOutput) {
         auto start = getCurrentTime();
-        std::vector<T> pivots;
-        int matrixSize = matrix.getSize();
-        T pivot;
-        T result = 1;
-        T number;
-        T delta = std::numeric_limits<T>::min();
-
-        for (int i = 0; i < matrixSize; ++i) {
-            // nájdenie pivota
-            pivot = 0;
-            for (int j = i; j < matrixSize; ++j) {
-                if (matrix[j][i] != 0) {
-                    if (j != i) {
-                        std::swap(matrix[i], matrix[j]);    // výmena riadkov
-                        result *= (-1);                     // zmena znamienka determinantu
-                    }
-                    pivot = matrix[i][i];
-                    pivots.push_back(pivot);
-                    break;
-                }
-            }
-
-            if (pivot == 0) {
-                result = 0;
-                break;
-            }
-
-            // úprava riadkov pod pivotom
-            for (int j = i + 1; j < matrixSize; ++j) {
-                number = -matrix[j][i];
-                for (int k = i; k < matrixSize; ++k) {
-                    matrix[j][k] += matrix[i][k] * (number / pivot);
-                    // nastavenie malých hodnôt blízkych nule na 0
-                    if (matrix[j][k] < delta && matrix[j][k] > -delta) {
-                        matrix[j][k] = 0;
-                    }
-                }
-            }
-        }
+        ScratchArena& arena = beginScratch();
+        T result = gaussElimination(matrix, arena, false);
+        auto end = getCurrentTime();
+        std::chrono::duration<double> elapsedTime = end - start;       // čas trvania výpočtu v sekundách
+        peakScratchBytes_ = arena.getPeakBytes();
 
-        // vynásobenie pivotov
-        if (result != 0) {
-            for (int i = 0; i < pivots.size(); ++i) {
-                result *= pivots[i];
-            }
+        recordResult(result);
+        if (characterOutput) {
+            outputResults("Gauss Elimination", result, elapsedTime);
         }
+        return elapsedTime.count();
+    }
 
+    /**
+     * Metóda parallelGaussEliminationMethod reprezentuje paralelný algoritmus Gaussovej eliminácie na výpočet determinantu štvorcovej matice.
+     * Úprava riadkov pod pivotom sa rozdelí medzi vlákna perzistentného poolu, pokiaľ je zvyšná podmatica väčšia ako parallelCutoff_.
+     *
+     * @tparam T dátový typ prvkov matice
+     * @param matrix referencia na maticu
+     * @param characterOutput či sa majú vypísať výsledky do konzoly (boolean)
+     * @return čas trvania výpočtu
+     */
+    template <typename T>
+    double parallelGaussEliminationMethod(Matrix<T>& matrix, bool characterOutput) {
+        auto start = getCurrentTime();
+        ScratchArena& arena = beginScratch();
+        T result = gaussElimination(matrix, arena, true);
         auto end = getCurrentTime();
         std::chrono::duration<double> elapsedTime = end - start;       // čas trvania výpočtu v sekundách
+        peakScratchBytes_ = arena.getPeakBytes();
 
+        recordResult(result);
         if (characterOutput) {
-            outputResults("Gauss Elimination", result, elapsedTime);
+            outputResults("Parallel Gauss Elimination", result, elapsedTime);
         }
         return elapsedTime.count();
     }
 
     /**
      * Metóda leibnizMethod reprezentuje algoritmus Leibnitzovej metódy na výpočet determinantu štvorcovej matice.
+     * Permutácie sa prechádzajú do hĺbky ako strom prefixov (pozri leibnizSubtree).
      *
      * @tparam T dátový typ prvkov matice
      * @param matrix referencia na maticu
@@ -94,49 +202,14 @@ public:
     template <typename T>
     double leibnizMethod(Matrix<T>& matrix, bool characterOutput) {
         auto start = getCurrentTime();
-        T result = 0;
-        int numberOfSwaps;
-        T product;
-        T number;
-        std::vector<int> columns;
-
-        // inicializácia stĺpcových indexov
-        for (int i = 0; i < matrix.getSize(); ++i) {
-            columns.push_back(i);
-        }
-
-        do {
-            product = 1;
-            for (int i = 0; i < matrix.getSize(); ++i) {
-                number = matrix[i][columns[i]];
-                if (number == 0) {
-                    product = 0;
-                    break;
-                }
-                product *= number;           // vynásobenie prvkov
-            }
-            // zisteniu počtu výmen potrebných na zoradenie indexov do vzostupného poradia
-            if (product != 0) {
-                numberOfSwaps = 0;
-                for (int i = 0; i < columns.size(); ++i) {
-                    for (int j = i + 1; j < columns.size(); ++j) {
-                        if (columns[i] > columns[j]) {
-                            numberOfSwaps++;
-                        }
-                    }
-                }
-                if (numberOfSwaps % 2 != 0) {
-                    product *= (-1);        // pri nepárnom počte výmen nastaví znamienko súčinu na záporné
-                }
-            }
-
-            result += product;          // pripočítanie súčinu k výsledku
-        } while (std::next_permutation(columns.begin(), columns.end()));    // pokračuje, dokým existujú ďalšie permutácie stĺpcových indexov
-
+        ScratchArena& arena = beginScratch();
+        T result = leibnizSubtree(matrix, static_cast<const int*>(nullptr), 0, arena);
         auto end = getCurrentTime();
 
         std::chrono::duration<double> elapsedTime = end - start;        // čas trvania výpočtu v sekundách
+        peakScratchBytes_ = arena.getPeakBytes();
 
+        recordResult(result);
         if (characterOutput) {
             outputResults("Leibniz method", result, elapsedTime);
         }
@@ -144,7 +217,12 @@ public:
     }
 
     /**
-     * Metóda luDecomposition reprezentuje algoritmus LU dekompozície na výpočet determinantu štvorcovej matice.
+     * Metóda parallelLeibnizMethod reprezentuje paralelnú Leibnitzovu metódu na výpočet determinantu štvorcovej matice.
+     * Permutácie v lexikografickom poradí sa rozdelia na súvislé úseky poradových čísel rovnakej dĺžky (n - L)!,
+     * kde L je najmenšia dĺžka prefixu, pri ktorej je úsekov aspoň LEIBNIZ_CHUNKS (nezávisí od počtu vlákien).
+     * Začiatok úseku c je permutácia s poradovým číslom c * (n - L)!, ktorej prefix sa získa z faktoriálovej sústavy
+     * (unranking), a úsek tvoria práve všetky permutácie s týmto prefixom. Vlákna si úseky berú dynamicky,
+     * súčet každého úseku sa uloží zvlášť a na konci sa sčítajú v poradí úsekov, takže výsledok nezávisí od počtu vlákien.
      *
      * @tparam T dátový typ prvkov matice
      * @param matrix referencia na maticu
@@ -152,68 +230,78 @@ public:
      * @return čas trvania výpočtu
      */
     template <typename T>
-    double luDecomposition(Matrix<T>& matrix, bool characterOutput) {
+    double parallelLeibnizMethod(Matrix<T>& matrix, bool characterOutput) {
         auto start = getCurrentTime();
+        ScratchArena& arena = beginScratch();
         int matrixSize = matrix.getSize();
-        T result = 1;
-        Matrix<T> L(matrixSize);
-        Matrix<T> U(matrixSize);
-        std::vector<T> diagonalElements;
-        T sum;
 
-        // usporiadanie riadkov matice, aby na diagonále neboli 0
-        for (int i = 0; i < matrixSize; ++i) {
-            for (int j = i; j < matrixSize; ++j) {
-                if (matrix[j][i] != 0) {
-                    if (j != i) {
-                        std::swap(matrix[i], matrix[j]);    // výmena riadkov
-                        result *= (-1);                     // zmena znamienka determinantu
-                    }
-                    break;
-                }
-            }
+        // dĺžka prefixu a počet úsekov n * (n - 1) * ... * (n - L + 1)
+        int prefixLength = 0;
+        int numberOfChunks = 1;
+        while (prefixLength < matrixSize && numberOfChunks < LEIBNIZ_CHUNKS) {
+            numberOfChunks *= matrixSize - prefixLength;
+            prefixLength++;
         }
+        T* chunkSums = arena.allocate<T>(numberOfChunks);
 
-        for (int i = 0; i < matrixSize; ++i) {
-            // výpočet prvkov matice U
-            for (int j = i; j < matrixSize; ++j) {
-                sum = 0;
-                for (int k = 0; k < i; ++k) {
-                    sum += L[i][k] * U[k][j];
-                }
-                U[i][j] = matrix[i][j] - sum;
+        beginThreadPeaks(getThreadPool().getThreadCount());
+        getThreadPool().parallelForDynamic(numberOfChunks, [&](int chunk, int thread) {
+            ScratchArena& localArena = ScratchArena::local();
+            ScratchScope scope(localArena);
+            int* prefix = localArena.allocate<int>(prefixLength);
+            int* available = localArena.allocate<int>(matrixSize);
+            for (int i = 0; i < matrixSize; ++i) {
+                available[i] = i;
             }
-
-            // kontrola, či sa nenachádza na diagonále U nula
-            if(U[i][i] == 0) {
-                result = 0;
-                break;
+            // číslice faktoriálovej sústavy (od najvyššieho rádu) určujú poradie stĺpca medzi ešte nepoužitými
+            int radixProduct = numberOfChunks;
+            int remainder = chunk;
+            for (int depth = 0; depth < prefixLength; ++depth) {
+                radixProduct /= matrixSize - depth;
+                int digit = remainder / radixProduct;
+                remainder %= radixProduct;
+                prefix[depth] = available[digit];
+                std::copy(available + digit + 1, available + matrixSize - depth, available + digit);
             }
-            diagonalElements.push_back(U[i][i]);
+            chunkSums[chunk] = leibnizSubtree(matrix, prefix, prefixLength, localArena);
+            recordThreadPeak(thread, scope);
+        });
 
-            // výpočet prvkov matice L
-            for (int j = i; j < matrixSize; ++j) {
-                if (j == i) {
-                    L[i][i] = 1;
-                } else {
-                    sum = 0;
-                    for (int k = 0; k < i; ++k) {
-                        sum += L[j][k] * U[k][i];
-                    }
-                    L[j][i] = (matrix[j][i] - sum) / U[i][i];
-                }
-            }
+        // deterministický súčet v poradí úsekov
+        T result = 0;
+        for (int chunk = 0; chunk < numberOfChunks; ++chunk) {
+            result += chunkSums[chunk];
         }
+        auto end = getCurrentTime();
 
-        // vynásobenie diagonálnych prvkov matice U
-        if (result != 0) {
-            for (int i = 0; i < diagonalElements.size(); ++i) {
-                result *= diagonalElements[i];
-            }
+        std::chrono::duration<double> elapsedTime = end - start;        // čas trvania výpočtu v sekundách
+        peakScratchBytes_ = arena.getPeakBytes() + getWorkerPeakBytes();
+
+        recordResult(result);
+        if (characterOutput) {
+            outputResults("Parallel Leibniz method", result, elapsedTime);
         }
+        return elapsedTime.count();
+    }
+
+    /**
+     * Metóda luDecomposition reprezentuje algoritmus LU dekompozície na výpočet determinantu štvorcovej matice.
+     *
+     * @tparam T dátový typ prvkov matice
+     * @param matrix referencia na maticu
+     * @param characterOutput či sa majú vypísať výsledky do konzoly (boolean)
+     * @return čas trvania výpočtu
+     */
+    template <typename T>
+    double luDecomposition(Matrix<T>& matrix, bool characterOutput) {
+        auto start = getCurrentTime();
+        ScratchArena& arena = beginScratch();
+        T result = luFactorization(matrix, arena);
         auto end = getCurrentTime();
         std::chrono::duration<double> elapsedTime = end - start;        // čas trvania výpočtu v sekundách
+        peakScratchBytes_ = arena.getPeakBytes();
 
+        recordResult(result);
         if (characterOutput) {
             outputResults("LU Decomposition", result, elapsedTime);
         }
@@ -222,161 +310,2668 @@ public:
     }
 
     /**
-     * Metóda laplaceMethod slúži na volanie algoritmu Laplaceovho rozvoja a zistenie dĺžky trvania algoritmu Laplaceovho rozvoja.
+     * Metóda sparseLuMethod reprezentuje riedky LU rozklad na výpočet determinantu riedkej matice (pozri sparseLuFactorization).
      *
      * @tparam T dátový typ prvkov matice
-     * @param matrix referencia na maticu
-     * @param variant varianta laplaceovho rozvoja
+     * @param matrix referencia na riedku maticu
      * @param characterOutput či sa majú vypísať výsledky do konzoly (boolean)
      * @return čas trvania výpočtu
      */
     template <typename T>
-    double laplaceMethod(Matrix<T>& matrix, laplaceVariant variant, bool characterOutput) {
+    double sparseLuMethod(SparseMatrix<T>& matrix, bool characterOutput) {
         auto start = getCurrentTime();
-        T result = laplaceExpansion(matrix, variant);
+        ScratchArena& arena = beginScratch();
+        T result = sparseLuFactorization(matrix, arena);
         auto end = getCurrentTime();
-
         std::chrono::duration<double> elapsedTime = end - start;        // čas trvania výpočtu v sekundách
+        peakScratchBytes_ = arena.getPeakBytes();
+
+        recordResult(result);
         if (characterOutput) {
-            switch (variant) {
-                case FULL_LAPLACE_EXPANSION: outputResults("Full Laplace expansion", result, elapsedTime); break;
-                case LAPLACE_RULE_OF_SARRUS: outputResults("Laplace expansion with Rule of Sarrus", result, elapsedTime); break;
-                default: std::cerr << "Invalid variant of the Laplace Expansion." << std::endl; break;
-            }
+            outputResults("Sparse LU Decomposition", result, elapsedTime);
         }
+
         return elapsedTime.count();
     }
 
-private:
     /**
-     * Metóda ruleOfSarrus reprezentuje algoritmus Sarusovho pravidla na výpočet determinantu štvorcovej matice.
+     * Metóda sparseLuMethod prevedie hustú maticu na riedku (v pomocnej pamäti) a vypočíta jej determinant riedkym LU rozkladom.
+     * Čas výpočtu zahŕňa aj prevod matice.
      *
      * @tparam T dátový typ prvkov matice
-     * @param matrix referencia na maticu
-     * @return hodnota determinantu
+     * @param matrix referencia na hustú maticu
+     * @param characterOutput či sa majú vypísať výsledky do konzoly (boolean)
+     * @return čas trvania výpočtu
      */
     template <typename T>
-    T ruleOfSarrus(Matrix<T>& matrix) {
-        T result = matrix[0][0] * matrix[1][1] * matrix[2][2]
-                   + matrix[0][1] * matrix[1][2] * matrix[2][0]
-                   + matrix[0][2] * matrix[1][0] * matrix[2][1]
-                   - matrix[0][2] * matrix[1][1] * matrix[2][0]
-                   - matrix[0][0] * matrix[1][2] * matrix[2][1]
-                   - matrix[0][1] * matrix[1][0] * matrix[2][2];
-        return result;
+    double sparseLuMethod(Matrix<T>& matrix, bool characterOutput) {
+        auto start = getCurrentTime();
+        ScratchArena& arena = beginScratch();
+        T result = sparseLuFactorization(matrix, arena);
+        auto end = getCurrentTime();
+        std::chrono::duration<double> elapsedTime = end - start;        // čas trvania výpočtu v sekundách
+        peakScratchBytes_ = arena.getPeakBytes();
+
+        recordResult(result);
+        if (characterOutput) {
+            outputResults("Sparse LU Decomposition", result, elapsedTime);
+        }
+
+        return elapsedTime.count();
     }
 
     /**
-     * Metóda laplaceExpansion reprezentuje algoritmus Laplaceovho rozvoja na výpočet determinantu štvorcovej matice.
+     * Metóda bandLuMethod reprezentuje pásový LU rozklad na výpočet determinantu pásovej matice (pozri bandLuFactorization).
+     * Determinant sa vypíše v semilogaritmickom tvare, aj keď je mimo rozsahu typu double.
      *
      * @tparam T dátový typ prvkov matice
-     * @param matrix referencia na maticu
-     * @param variant varianta laplaceovho rozvoja
-     * @return hodnota determinantu
+     * @param matrix referencia na pásovú maticu
+     * @param characterOutput či sa majú vypísať výsledky do konzoly (boolean)
+     * @return čas trvania výpočtu
      */
     template <typename T>
-    T laplaceExpansion(Matrix<T>& matrix, laplaceVariant variant) {
-        int matrixSize = matrix.getSize();
+    double bandLuMethod(BandMatrix<T>& matrix, bool characterOutput) {
+        auto start = getCurrentTime();
+        ScratchArena& arena = beginScratch();
+        scaledValue result = bandLuFactorization(matrix, arena);
+        auto end = getCurrentTime();
+        std::chrono::duration<double> elapsedTime = end - start;        // čas trvania výpočtu v sekundách
+        peakScratchBytes_ = arena.getPeakBytes();
 
-        // ak je matica veľkosti 3 a varianta je Laplaceov rozvoj s použitím Sarusovho pravidla, tak vráti hodnotu determinantu vypočítanú Sarusovým pravidlom
-        if (matrixSize == 3 && variant == laplaceVariant::LAPLACE_RULE_OF_SARRUS) {
-            return ruleOfSarrus(matrix);
+        recordResult(std::ldexp(result.mantissa, static_cast<int>(std::clamp(result.exponent, -100000LL, 100000LL))));
+        if (characterOutput) {
+            outputResults("Band LU Decomposition", formatScaledValue(result), elapsedTime);
+            std::cout << "Bandwidth of the matrix: " << matrix.getLowerBandwidth() << " lower, " << matrix.getUpperBandwidth() << " upper" << std::endl;
         }
 
-        int newRow;
-        int newColumn;
-        T result = 0;
-        T element;
-        int maxNumberOfZerosInColumn = 0;
-        int maxNumberOfZerosInRow = 0;
-        int indexOfRow = 0;
-        int indexOfColumn = 0;
+        return elapsedTime.count();
+    }
 
-        // nájdenie riadku s najväčším počtom núl
-        for (int i = 0; i < matrixSize; ++i) {
-            int zerosInRow = 0;
-            for (int j = 0; j < matrixSize; ++j) {
-                if (matrix[i][j] == 0) {
-                    zerosInRow++;
-                }
-            }
-            if (zerosInRow > maxNumberOfZerosInRow) {
-                maxNumberOfZerosInRow = zerosInRow;
-                indexOfRow = i;
-            }
-        }
+    /**
+     * Metóda bandLuMethod preusporiada riadky a stĺpce riedkej matice obráteným Cuthillovým-McKeeho algoritmom
+     * (symetrická permutácia, determinant sa nezmení), uloží ju ako pásovú maticu a vypočíta jej determinant
+     * pásovým LU rozkladom. Čas výpočtu zahŕňa aj preusporiadanie a prevod matice.
+     *
+     * @tparam T dátový typ prvkov matice
+     * @param matrix referencia na riedku maticu
+     * @param characterOutput či sa majú vypísať výsledky do konzoly (boolean)
+     * @return čas trvania výpočtu
+     */
+    template <typename T>
+    double bandLuMethod(SparseMatrix<T>& matrix, bool characterOutput) {
+        auto start = getCurrentTime();
+        ScratchArena& arena = beginScratch();
+        BandMatrix<T> band(matrix, StructuralAnalysis(matrix).getBandwidthReducingOrder());
+        scaledValue result = bandLuFactorization(band, arena);
+        auto end = getCurrentTime();
+        std::chrono::duration<double> elapsedTime = end - start;        // čas trvania výpočtu v sekundách
+        peakScratchBytes_ = arena.getPeakBytes();
 
-        // nájdenie stĺpca s najväčším počtom núl
-        for (int j = 0; j < matrixSize; ++j) {
-            int zerosInColumn = 0;
-            for (int i = 0; i < matrixSize; ++i) {
-                if (matrix[i][j] == 0) {
-                    zerosInColumn++;
-                }
-                if (zerosInColumn > maxNumberOfZerosInColumn) {
-                    maxNumberOfZerosInColumn = zerosInColumn;
-                    indexOfColumn = j;
-                }
-            }
+        recordResult(std::ldexp(result.mantissa, static_cast<int>(std::clamp(result.exponent, -100000LL, 100000LL))));
+        if (characterOutput) {
+            outputResults("Band LU Decomposition", formatScaledValue(result), elapsedTime);
+            std::cout << "Bandwidth after the reverse Cuthill-McKee reordering: " << band.getLowerBandwidth() << " lower, " << band.getUpperBandwidth() << " upper" << std::endl;
         }
 
-        // na základe počtu núl, bude výpočet pokračovať buď podľa riadka alebo podľa stĺpca
-        if (maxNumberOfZerosInRow >= maxNumberOfZerosInColumn) {
-            for (int i = 0; i < matrixSize; ++i) {
-                // vytvorenie nových matíc (o jeden stupeň menších)
-                Matrix<T> newMatrix(matrixSize - 1);
-                element = matrix[indexOfRow][i];
-                newRow = 0;
-                for (int j = 0; j < matrixSize; ++j) {
-                    if (j != indexOfRow) {
-                        newColumn = 0;
-                        for (int k = 0; k < matrixSize; ++k) {
-                            if (k != i) {
-                                newMatrix[newRow][newColumn] = matrix[j][k];
-                                newColumn++;
-                            }
-                        }
-                        newRow++;
-                    }
-                }
-                // na základe veľkostí nových matíc a hodnoty elementu pokračuje vo výpočte
-                if (newMatrix.getSize() > 1) {
-                    if (element != 0) {
-                        result += element * std::pow(-1, indexOfRow + i) * laplaceExpansion(newMatrix, variant);
-                    }
-                } else {
-                    result += element * std::pow(-1, indexOfRow + i) * newMatrix[0][0];
+        return elapsedTime.count();
+    }
+
+    /**
+     * Metóda bandLuMethod prevedie hustú maticu na riedku a vypočíta jej determinant pásovým LU rozkladom
+     * po preusporiadaní obráteným Cuthillovým-McKeeho algoritmom. Čas výpočtu zahŕňa aj prevod matice.
+     *
+     * @tparam T dátový typ prvkov matice
+     * @param matrix referencia na hustú maticu
+     * @param characterOutput či sa majú vypísať výsledky do konzoly (boolean)
+     * @return čas trvania výpočtu
+     */
+    template <typename T>
+    double bandLuMethod(Matrix<T>& matrix, bool characterOutput) {
+        auto start = getCurrentTime();
+        SparseMatrix<T> sparse(matrix);
+        std::chrono::duration<double> conversionTime = getCurrentTime() - start;
+        return conversionTime.count() + bandLuMethod(sparse, characterOutput);
+    }
+
+    /**
+     * Metóda detectStructure zistí jedným prechodom maticou (O(n^2)), či je matica diagonálna, trojuholníková,
+     * trojdiagonálna alebo Hessenbergova. V každom riadku sa hľadá prvý nenulový prvok zľava (po diagonálu) a sprava
+     * (po diagonálu), prechod skončí, keď sú nenulové prvky aspoň dve diagonály pod aj nad hlavnou diagonálou.
+     *
+     * @tparam T dátový typ prvkov matice
+     * @param matrix referencia na maticu
+     * @return rozloženie nenulových prvkov matice
+     */
+    template <typename T>
+    static matrixStructure detectStructure(Matrix<T>& matrix) {
+        int matrixSize = matrix.getSize();
+        int lower = 0;      // najväčšia vzdialenosť nenulového prvku pod diagonálou
+        int upper = 0;      // najväčšia vzdialenosť nenulového prvku nad diagonálou
+        for (int i = 0; i < matrixSize && (lower < 2 || upper < 2); ++i) {
+            const T* row = matrix[i];
+            for (int j = 0; j < i - lower; ++j) {
+                if (row[j] != 0) {
+                    lower = i - j;
+                    break;
                 }
             }
-        } else {
-            for (int i = 0; i < matrixSize; ++i) {
-                // vytvorenie nových matíc (o jeden stupeň menších)
-                Matrix<T> newMatrix(matrixSize - 1);
-                element = matrix[i][indexOfColumn];
-                newRow = 0;
-                for (int j = 0; j < matrixSize; ++j) {
-                    if (j != i) {
-                        newColumn = 0;
-                        for (int k = 0; k < matrixSize; ++k) {
-                            if (k != indexOfColumn) {
-                                newMatrix[newRow][newColumn] = matrix[j][k];
-                                newColumn++;
-                            }
-                        }
-                        newRow++;
-                    }
-                }
-                // na základe veľkostí nových matíc a hodnoty elementu pokračuje vo výpočte
-                if (newMatrix.getSize() > 1) {
-                    if (element != 0) {
-                         result += element * std::pow(-1, indexOfColumn + i) * laplaceExpansion(newMatrix, variant);
-                    }
-                } else {
-                    result += element * std::pow(-1, indexOfColumn + i) * newMatrix[0][0];
+            for (int j = matrixSize - 1; j > i + upper; --j) {
+                if (row[j] != 0) {
+                    upper = j - i;
+                    break;
                 }
             }
         }
-        return result;
+        if (lower == 0) {
+            return upper == 0 ? DIAGONAL_MATRIX : UPPER_TRIANGULAR_MATRIX;
+        }
+        if (upper == 0) {
+            return LOWER_TRIANGULAR_MATRIX;
+        }
+        if (lower == 1) {
+            return upper == 1 ? TRIDIAGONAL_MATRIX : UPPER_HESSENBERG_MATRIX;
+        }
+        return upper == 1 ? LOWER_HESSENBERG_MATRIX : GENERAL_MATRIX;
+    }
+
+    /**
+     * Metóda structuredMethod vypočíta determinant matice so špeciálnym rozložením nenulových prvkov bez eliminácie:
+     * diagonálnej a trojuholníkovej matice ako súčin diagonály (O(n)), trojdiagonálnej matice rekurenciou pre kontinuant (O(n))
+     * a Hessenbergovej matice v čase O(n^2) (dolná Hessenbergova matica sa počíta transponovaná). Celočíselné matice
+     * sa počítajú presne (BigInteger).
+     *
+     * @tparam T dátový typ prvkov matice
+     * @param matrix referencia na maticu
+     * @param structure rozloženie nenulových prvkov matice (výsledok detectStructure)
+     * @param characterOutput či sa majú vypísať výsledky do konzoly (boolean)
+     * @return čas trvania výpočtu
+     */
+    template <typename T>
+    double structuredMethod(Matrix<T>& matrix, matrixStructure structure, bool characterOutput) {
+        using R = std::conditional_t<std::is_integral_v<T>, BigInteger, T>;
+        auto start = getCurrentTime();
+        ScratchArena& arena = beginScratch();
+        int matrixSize = matrix.getSize();
+        auto element = [&](int row, int column) { return matrix[row][column]; };
+        auto transposedElement = [&](int row, int column) { return matrix[column][row]; };
+        R result;
+        switch (structure) {
+            case TRIDIAGONAL_MATRIX: result = tridiagonalContinuant<R>(matrixSize, element); break;
+            case UPPER_HESSENBERG_MATRIX: result = hessenbergDeterminant<T, R>(matrixSize, element, arena); break;
+            case LOWER_HESSENBERG_MATRIX: result = hessenbergDeterminant<T, R>(matrixSize, transposedElement, arena); break;
+            default: result = diagonalProduct<R>(matrixSize, element); break;
+        }
+        auto end = getCurrentTime();
+        std::chrono::duration<double> elapsedTime = end - start;        // čas trvania výpočtu v sekundách
+        peakScratchBytes_ = arena.getPeakBytes();
+
+        recordResult(result);
+        if (characterOutput) {
+            outputResults("Structured Determinant", result, elapsedTime);
+        }
+
+        return elapsedTime.count();
+    }
+
+    /**
+     * Metóda blockedLuDecomposition reprezentuje blokový algoritmus LU dekompozície s čiastočným pivotovaním na výpočet determinantu štvorcovej matice.
+     * Matica sa rozkladá priamo na mieste (L pod diagonálou, U na diagonále a nad ňou) po blokoch stĺpcov šírky luBlockSize_:
+     * najskôr sa rozloží panel (blok stĺpcov), potom sa dopočíta blokový riadok U a nakoniec sa upraví zvyšná podmatica
+     * násobením matíc po malých dlaždiciach, ktorých medzivýsledky ostávajú v registroch.
+     *
+     * @tparam T dátový typ prvkov matice
+     * @param matrix referencia na maticu
+     * @param characterOutput či sa majú vypísať výsledky do konzoly (boolean)
+     * @return čas trvania výpočtu
+     */
+    template <typename T>
+    double blockedLuDecomposition(Matrix<T>& matrix, bool characterOutput) {
+        auto start = getCurrentTime();
+        ScratchArena& arena = beginScratch();
+        int matrixSize = matrix.getSize();
+        T result = 1;
+        // jadro úpravy riadku s hranicou 0 nenastavuje žiadne hodnoty na 0, predstavuje teda iba target += factor * source
+        SimdKernels::RowUpdateKernel<T> rowUpdate = SimdKernels::rowUpdateKernel<T>();
+
+        for (int k = 0; k < matrixSize && result != 0; k += luBlockSize_) {
+            int blockEnd = std::min(k + luBlockSize_, matrixSize);
+
+            // rozklad panelu (stĺpce k..blockEnd-1) s čiastočným pivotovaním
+            for (int p = k; p < blockEnd; ++p) {
+                int pivotRow = p;
+                for (int i = p + 1; i < matrixSize; ++i) {
+                    if (absoluteValue(matrix[i][p]) > absoluteValue(matrix[pivotRow][p])) {
+                        pivotRow = i;
+                    }
+                }
+                if (matrix[pivotRow][p] == 0) {
+                    result = 0;
+                    break;
+                }
+                if (pivotRow != p) {
+                    std::swap(matrix[p], matrix[pivotRow]);     // výmena riadkov
+                    result *= (-1);                             // zmena znamienka determinantu
+                }
+                T pivot = matrix[p][p];
+                result *= pivot;
+                for (int i = p + 1; i < matrixSize; ++i) {
+                    T* row = matrix[i];
+                    row[p] /= pivot;
+                    if (row[p] != 0) {
+                        rowUpdate(row + p + 1, matrix[p] + p + 1, -row[p], 0, blockEnd - p - 1);
+                    }
+                }
+            }
+            if (result == 0 || blockEnd == matrixSize) {
+                break;
+            }
+
+            // výpočet blokového riadku U (dopredná substitúcia s dolnou trojuholníkovou maticou L panelu)
+            for (int p = k; p < blockEnd; ++p) {
+                for (int i = p + 1; i < blockEnd; ++i) {
+                    if (matrix[i][p] != 0) {
+                        rowUpdate(matrix[i] + blockEnd, matrix[p] + blockEnd, -matrix[i][p], 0, matrixSize - blockEnd);
+                    }
+                }
+            }
+
+            // úprava zvyšnej podmatice: A22 = A22 - L21 * U12
+            blockedLuTrailingUpdate(matrix, k, blockEnd, blockEnd, matrixSize);
+        }
+
+        auto end = getCurrentTime();
+        std::chrono::duration<double> elapsedTime = end - start;        // čas trvania výpočtu v sekundách
+        peakScratchBytes_ = arena.getPeakBytes();
+
+        recordResult(result);
+        if (characterOutput) {
+            outputResults("Blocked LU Decomposition", result, elapsedTime);
+        }
+
+        return elapsedTime.count();
+    }
+
+    /**
+     * Metóda tiledLuDecomposition reprezentuje dlaždicový algoritmus LU dekompozície s čiastočným pivotovaním na výpočet determinantu štvorcovej matice.
+     * Matica sa rozdelí na pásy stĺpcov šírky luBlockSize_ a výpočet sa vyjadrí ako graf úloh:
+     * rozklad panelu k (pivotovanie a L v páse k) a úprava pásu j panelom k (výmeny riadkov, trojuholníková sústava pre U
+     * a úprava dlaždíc pod panelom). Úprava pásu j panelom k čaká na rozklad panelu k a na úpravu pásu j panelom k - 1,
+     * rozklad panelu k + 1 iba na úpravu jeho pásu panelom k. Ďalší panel sa tak rozkladá ešte počas úprav ostatných pásov
+     * (lookahead) a úlohy rozdeľuje plánovač s kradnutím práce, namiesto bariéry po každom pivote.
+     * Výmeny riadkov sa vykonávajú fyzicky v rámci pásu, pretože ostatné pásy môžu byť súčasne upravované inými vláknami.
+     *
+     * @tparam T dátový typ prvkov matice
+     * @param matrix referencia na maticu
+     * @param characterOutput či sa majú vypísať výsledky do konzoly (boolean)
+     * @return čas trvania výpočtu
+     */
+    template <typename T>
+    double tiledLuDecomposition(Matrix<T>& matrix, bool characterOutput) {
+        auto start = getCurrentTime();
+        ScratchArena& arena = beginScratch();
+        int matrixSize = matrix.getSize();
+        int tileSize = luBlockSize_;
+        int numberOfStrips = (matrixSize + tileSize - 1) / tileSize;
+        int* pivotRows = arena.allocate<int>(matrixSize);       // riadok pivota pre každý stĺpec
+        std::atomic<bool> singular(false);
+        SimdKernels::RowUpdateKernel<T> rowUpdate = SimdKernels::rowUpdateKernel<T>();
+
+        enum taskType { PANEL_TASK, UPDATE_TASK };
+        TaskGraph graph({ "Panel factorisation", "Strip update (swaps, triangular solve, trailing update)" });
+        std::vector<Task*> previousUpdates(numberOfStrips, nullptr);    // posledná úloha úpravy každého pásu
+
+        for (int k = 0; k < numberOfStrips; ++k) {
+            int panelStart = k * tileSize;
+            int panelEnd = std::min(panelStart + tileSize, matrixSize);
+
+            // rozklad panelu k s čiastočným pivotovaním (výmeny riadkov iba v rámci pásu k)
+            Task* panel = graph.addTask(PANEL_TASK, [&matrix, &singular, pivotRows, panelStart, panelEnd, matrixSize, rowUpdate] {
+                if (singular.load(std::memory_order_relaxed)) {
+                    return;
+                }
+                for (int p = panelStart; p < panelEnd; ++p) {
+                    int pivotRow = p;
+                    for (int i = p + 1; i < matrixSize; ++i) {
+                        if (absoluteValue(matrix[i][p]) > absoluteValue(matrix[pivotRow][p])) {
+                            pivotRow = i;
+                        }
+                    }
+                    pivotRows[p] = pivotRow;
+                    if (matrix[pivotRow][p] == 0) {
+                        singular.store(true, std::memory_order_relaxed);
+                        return;
+                    }
+                    if (pivotRow != p) {
+                        std::swap_ranges(matrix[p] + panelStart, matrix[p] + panelEnd, matrix[pivotRow] + panelStart);
+                    }
+                    T pivot = matrix[p][p];
+                    for (int i = p + 1; i < matrixSize; ++i) {
+                        T* row = matrix[i];
+                        row[p] /= pivot;
+                        if (row[p] != 0) {
+                            rowUpdate(row + p + 1, matrix[p] + p + 1, -row[p], 0, panelEnd - p - 1);
+                        }
+                    }
+                }
+            });
+            if (previousUpdates[k] != nullptr) {
+                graph.addDependency(previousUpdates[k], panel);
+            }
+
+            // úpravy pásov napravo od panelu (od posledného, aby sa úprava nasledujúceho pásu vykonala ako prvá)
+            for (int j = numberOfStrips - 1; j > k; --j) {
+                int stripStart = j * tileSize;
+                int stripEnd = std::min(stripStart + tileSize, matrixSize);
+                Task* update = graph.addTask(UPDATE_TASK, [this, &matrix, &singular, pivotRows, panelStart, panelEnd, stripStart, stripEnd, rowUpdate] {
+                    if (singular.load(std::memory_order_relaxed)) {
+                        return;
+                    }
+                    // výmeny riadkov panelu k v páse j
+                    for (int p = panelStart; p < panelEnd; ++p) {
+                        if (pivotRows[p] != p) {
+                            std::swap_ranges(matrix[p] + stripStart, matrix[p] + stripEnd, matrix[pivotRows[p]] + stripStart);
+                        }
+                    }
+                    // trojuholníková sústava pre blok U v páse j
+                    for (int p = panelStart; p < panelEnd; ++p) {
+                        for (int i = p + 1; i < panelEnd; ++i) {
+                            if (matrix[i][p] != 0) {
+                                rowUpdate(matrix[i] + stripStart, matrix[p] + stripStart, -matrix[i][p], 0, stripEnd - stripStart);
+                            }
+                        }
+                    }
+                    // úprava dlaždíc pásu j pod panelom
+                    blockedLuTrailingUpdate(matrix, panelStart, panelEnd, stripStart, stripEnd);
+                });
+                graph.addDependency(panel, update);
+                if (previousUpdates[j] != nullptr) {
+                    graph.addDependency(previousUpdates[j], update);
+                }
+                previousUpdates[j] = update;
+            }
+        }
+        getTaskScheduler().execute(graph);
+
+        T result = 1;
+        if (singular.load()) {
+            result = 0;
+        } else {
+            for (int i = 0; i < matrixSize; ++i) {
+                if (pivotRows[i] != i) {
+                    result *= (-1);             // zmena znamienka determinantu
+                }
+                result *= matrix[i][i];
+            }
+        }
+
+        auto end = getCurrentTime();
+        std::chrono::duration<double> elapsedTime = end - start;        // čas trvania výpočtu v sekundách
+        peakScratchBytes_ = arena.getPeakBytes();
+
+        recordResult(result);
+        if (characterOutput) {
+            outputResults("Tiled Task-DAG LU Decomposition", result, elapsedTime);
+            std::cout << graph.getTimingReport();
+        }
+
+        return elapsedTime.count();
+    }
+
+    /**
+     * Metóda bareissMethod reprezentuje Bareissov algoritmus (eliminácia bez zlomkov) na výpočet determinantu štvorcovej matice.
+     * V kroku k sa prvky pod pivotom upravia na a[i][j] = (a[i][j] * a[k][k] - a[i][k] * a[k][j]) / a[k-1][k-1],
+     * kde delenie je vždy bezo zvyšku a každý medzivýsledok je determinantom podmatice pôvodnej matice.
+     * Pre celočíselné matice je výsledok presný: výpočet prebieha v 64-bitových číslach s kontrolou pretečenia
+     * a až pri pretečení pokračuje od rozpracovaného riadku v 128-bitových číslach a následne v číslach BigInteger.
+     * Pre matice s desatinnými číslami prebieha v type T s čiastočným pivotovaním.
+     *
+     * @tparam T dátový typ prvkov matice
+     * @param matrix referencia na maticu
+     * @param characterOutput či sa majú vypísať výsledky do konzoly (boolean)
+     * @return čas trvania výpočtu
+     */
+    template <typename T>
+    double bareissMethod(Matrix<T>& matrix, bool characterOutput) {
+        auto start = getCurrentTime();
+        ScratchArena& arena = beginScratch();
+        int matrixSize = matrix.getSize();
+        bareissState state = { 0, 1, 1, false };
+
+        if constexpr (std::is_integral_v<T>) {
+            BigInteger result;
+            std::string precision = "64-bit integers";
+            long long** rows = arena.allocate<long long*>(matrixSize);
+            long long* buffer = arena.allocate<long long>(matrixSize);
+            for (int i = 0; i < matrixSize; ++i) {
+                rows[i] = arena.allocate<long long>(matrixSize);
+                std::copy(matrix[i], matrix[i] + matrixSize, rows[i]);
+            }
+            if (bareissElimination(rows, matrixSize, state, buffer)) {
+                result = state.singular ? BigInteger() : BigInteger(rows[matrixSize - 1][matrixSize - 1]);
+            } else {
+#ifdef BAKALARSKAPRACA_INT128
+                precision = "128-bit integers";
+                __int128** wideRows = widenRows<__int128>(rows, matrixSize, arena);
+                if (bareissElimination(wideRows, matrixSize, state, arena.allocate<__int128>(matrixSize))) {
+                    result = state.singular ? BigInteger() : BigInteger(wideRows[matrixSize - 1][matrixSize - 1]);
+                } else {
+                    precision = "big integers";
+                    result = bareissBigInteger(wideRows, matrixSize, state);
+                }
+#else
+                precision = "big integers";
+                result = bareissBigInteger(rows, matrixSize, state);
+#endif
+            }
+            if (state.sign < 0) {
+                result = -result;
+            }
+
+            auto end = getCurrentTime();
+            std::chrono::duration<double> elapsedTime = end - start;        // čas trvania výpočtu v sekundách
+            peakScratchBytes_ = arena.getPeakBytes();
+            recordResult(result);
+            if (characterOutput) {
+                outputResults("Bareiss Algorithm", result, elapsedTime);
+                std::cout << "Working precision of the Bareiss Algorithm: " << precision << std::endl;
+            }
+            return elapsedTime.count();
+        } else {
+            T result = 0;
+            if (bareissElimination(matrix.getRows(), matrixSize, state, static_cast<T*>(nullptr)) && !state.singular) {
+                result = state.sign * matrix[matrixSize - 1][matrixSize - 1];
+            }
+
+            auto end = getCurrentTime();
+            std::chrono::duration<double> elapsedTime = end - start;        // čas trvania výpočtu v sekundách
+            peakScratchBytes_ = arena.getPeakBytes();
+            recordResult(result);
+            if (characterOutput) {
+                outputResults("Bareiss Algorithm", result, elapsedTime);
+            }
+            return elapsedTime.count();
+        }
+    }
+
+    /**
+     * Metóda multiModularMethod reprezentuje multimodulárny algoritmus na presný výpočet determinantu celočíselnej matice.
+     * Determinant sa vypočíta Gaussovou elimináciou modulo veľa prvočísel menších ako 2^31 (Montgomeryho aritmetika,
+     * vektorizovaná úprava riadkov), prvočísla jednej dávky sa počítajú paralelne. Výsledky sa postupne skladajú
+     * pomocou čínskej zvyškovej vety (Garnerov algoritmus) do čísla v symetrickom intervale (-M/2, M/2].
+     * Výpočet skončí, keď súčin prvočísel M presiahne dvojnásobok Hadamardovho odhadu |det| <= prod ||riadok||,
+     * alebo keď sa výsledok nezmení pri STABLE_PRIMES po sebe idúcich prvočíslach (pravdepodobnosť chyby je menšia ako 2^(-90)).
+     *
+     * @tparam T dátový typ prvkov matice (celočíselný)
+     * @param matrix referencia na maticu
+     * @param characterOutput či sa majú vypísať výsledky do konzoly (boolean)
+     * @return čas trvania výpočtu
+     */
+    template <typename T>
+    double multiModularMethod(Matrix<T>& matrix, bool characterOutput) {
+        if constexpr (!std::is_integral_v<T>) {
+            std::cerr << "The Multi-Modular Method requires a matrix of integers." << std::endl;
+            return 0;
+        } else {
+            auto start = getCurrentTime();
+            ScratchArena& arena = beginScratch();
+            int matrixSize = matrix.getSize();
+
+            // Hadamardov odhad v bitoch, nulový riadok znamená nulový determinant
+            double hadamardBits = 0;
+            bool zeroRow = false;
+            for (int i = 0; i < matrixSize; ++i) {
+                double norm = 0;
+                for (int j = 0; j < matrixSize; ++j) {
+                    norm += static_cast<double>(matrix[i][j]) * static_cast<double>(matrix[i][j]);
+                }
+                zeroRow = zeroRow || norm == 0;
+                hadamardBits += 0.5 * std::log2(std::max(norm, 1.0));
+            }
+
+            int batchSize = threadCount_ * PRIMES_PER_THREAD;
+            std::uint32_t* primes = arena.allocate<std::uint32_t>(batchSize);
+            std::uint32_t* residues = arena.allocate<std::uint32_t>(batchSize);
+            std::uint32_t primeBound = 1u << 31;
+            BigInteger result;                  // výsledok v intervale [0, M)
+            BigInteger symmetricResult;         // výsledok v intervale (-M/2, M/2]
+            BigInteger modulus(1);              // súčin použitých prvočísel M
+            double modulusBits = 0;
+            int primesUsed = 0;
+            int stableCount = 0;
+            bool finished = zeroRow;
+            bool stabilised = false;
+
+            beginThreadPeaks(getThreadPool().getThreadCount());
+            while (!finished) {
+                for (int i = 0; i < batchSize; ++i) {
+                    primeBound = MontgomeryField::previousPrime(primeBound);
+                    primes[i] = primeBound;
+                }
+                getThreadPool().parallelForDynamic(batchSize, [&](int index, int thread) {
+                    ScratchScope scope(ScratchArena::local());
+                    residues[index] = modularDeterminant(matrix, MontgomeryField(primes[index]));
+                    recordThreadPeak(thread, scope);
+                });
+
+                // Garnerov krok: x = x + M * ((r - x) * M^(-1) mod p), M = M * p
+                for (int i = 0; i < batchSize && !finished; ++i) {
+                    std::uint64_t prime = primes[i];
+                    std::uint64_t difference = (residues[i] + prime - result.remainder(primes[i])) % prime;
+                    std::uint64_t inverse = modularInverse(modulus.remainder(primes[i]), primes[i]);
+                    result += modulus * BigInteger(static_cast<long long>(difference * inverse % prime));
+                    modulus *= BigInteger(static_cast<long long>(prime));
+                    modulusBits += std::log2(static_cast<double>(prime));
+                    primesUsed++;
+
+                    BigInteger previous = std::move(symmetricResult);
+                    symmetricResult = result + result > modulus ? result - modulus : result;
+                    stableCount = primesUsed > 1 && symmetricResult == previous ? stableCount + 1 : 0;
+                    stabilised = stableCount >= STABLE_PRIMES;
+                    // rezerva 2 bity pokrýva znamienko a zaokrúhlenie logaritmov
+                    finished = stabilised || modulusBits > hadamardBits + 2;
+                }
+            }
+
+            auto end = getCurrentTime();
+            std::chrono::duration<double> elapsedTime = end - start;        // čas trvania výpočtu v sekundách
+            peakScratchBytes_ = arena.getPeakBytes() + getWorkerPeakBytes();
+            recordResult(symmetricResult);
+            if (characterOutput) {
+                outputResults("Multi-Modular Method", symmetricResult, elapsedTime);
+                std::cout << "Number of primes used by the Multi-Modular Method: " << primesUsed;
+                if (zeroRow) {
+                    std::cout << " (zero row)" << std::endl;
+                } else {
+                    std::cout << (stabilised ? " (result stabilised)" : " (Hadamard bound reached)") << std::endl;
+                }
+            }
+            return elapsedTime.count();
+        }
+    }
+
+    /**
+     * Metóda laplaceMethod slúži na volanie algoritmu Laplaceovho rozvoja a zistenie dĺžky trvania algoritmu Laplaceovho rozvoja.
+     * Varianta LAPLACE_SUBSET_DP počíta minory po úrovniach (pozri laplaceSubsetDp). Ak by jej tabuľky presiahli
+     * LAPLACE_DP_MEMORY_LIMIT, výpočet pokračuje úplným Laplaceovým rozvojom.
+     *
+     * @tparam T dátový typ prvkov matice
+     * @param matrix referencia na maticu
+     * @param variant varianta laplaceovho rozvoja
+     * @param characterOutput či sa majú vypísať výsledky do konzoly (boolean)
+     * @return čas trvania výpočtu
+     */
+    template <typename T>
+    double laplaceMethod(Matrix<T>& matrix, laplaceVariant variant, bool characterOutput) {
+        auto start = getCurrentTime();
+        ScratchArena& arena = beginScratch();
+        int matrixSize = matrix.getSize();
+        int* indices = arena.allocate<int>(static_cast<std::size_t>(matrixSize) * (2 * matrixSize + 1));
+        // prvých size indexov tvorí identitu pre riadky aj stĺpce celej matice, zvyšok slúži pre podmatice v rekurzii
+        for (int i = 0; i < matrixSize; ++i) {
+            indices[i] = i;
+        }
+        MatrixView<T> view(matrix.getRows(), indices, indices, matrixSize);
+        if (variant == LAPLACE_SUBSET_DP && 2 * sizeof(T) * largestBinomial(matrixSize) > LAPLACE_DP_MEMORY_LIMIT) {
+            std::cerr << "The minor tables of the subset DP would exceed the memory limit, the full Laplace expansion is used instead." << std::endl;
+            variant = FULL_LAPLACE_EXPANSION;
+        }
+        T result;
+        if (variant == LAPLACE_SUBSET_DP) {
+            result = laplaceSubsetDp(matrix, arena);
+        } else {
+            result = matrixSize > 1 ? laplaceExpansion(view, variant, indices + matrixSize) : view(0, 0);
+        }
+        auto end = getCurrentTime();
+
+        std::chrono::duration<double> elapsedTime = end - start;        // čas trvania výpočtu v sekundách
+        peakScratchBytes_ = arena.getPeakBytes();
+        recordResult(result);
+        if (characterOutput) {
+            switch (variant) {
+                case FULL_LAPLACE_EXPANSION: outputResults("Full Laplace expansion", result, elapsedTime); break;
+                case LAPLACE_RULE_OF_SARRUS: outputResults("Laplace expansion with Rule of Sarrus", result, elapsedTime); break;
+                case LAPLACE_SUBSET_DP: outputResults("Laplace expansion with subset DP", result, elapsedTime); break;
+                default: std::cerr << "Invalid variant of the Laplace Expansion." << std::endl; break;
+            }
+        }
+        return elapsedTime.count();
+    }
+
+    /**
+     * Metóda hybridLaplaceMethod reprezentuje hybridný Laplaceov rozvoj: matica sa rozvíja podľa riadkov (stĺpcov) s najviac
+     * nulami, kým stupeň minoru neklesne na hybridCutoff_, a determinanty týchto minorov sa vypočítajú LU rozkladom
+     * s čiastočnou pivotizáciou. Horné úrovne rozvoja tak využijú riedkosť matice (nulové prvky a nulové riadky),
+     * namiesto faktoriálneho počtu malých minorov sa počíta menej minorov v čase O(cutoff^3). Výpočet prebieha
+     * v aritmetike s pohyblivou rádovou čiarkou.
+     *
+     * @tparam T dátový typ prvkov matice
+     * @param matrix referencia na maticu
+     * @param characterOutput či sa majú vypísať výsledky do konzoly (boolean)
+     * @return čas trvania výpočtu
+     */
+    template <typename T>
+    double hybridLaplaceMethod(Matrix<T>& matrix, bool characterOutput) {
+        auto start = getCurrentTime();
+        ScratchArena& arena = beginScratch();
+        int matrixSize = matrix.getSize();
+        int cutoff = std::min(hybridCutoff_, matrixSize);
+        int* indices = arena.allocate<int>(static_cast<std::size_t>(matrixSize) * (2 * matrixSize + 1));
+        for (int i = 0; i < matrixSize; ++i) {
+            indices[i] = i;
+        }
+        MatrixView<T> view(matrix.getRows(), indices, indices, matrixSize);
+        int* indexBuffer = indices + matrixSize;
+        int* zeroCounts = indexBuffer + matrixSize * (matrixSize - 1);
+        T* luBuffer = cutoff > STATIC_DETERMINANT_MAX_SIZE ? arena.allocate<T>(static_cast<std::size_t>(cutoff) * cutoff) : nullptr;
+        countZeros(view, zeroCounts);
+        T result = hybridLaplaceExpansion(view, indexBuffer, zeroCounts, cutoff, luBuffer);
+        auto end = getCurrentTime();
+
+        std::chrono::duration<double> elapsedTime = end - start;        // čas trvania výpočtu v sekundách
+        peakScratchBytes_ = arena.getPeakBytes();
+        recordResult(result);
+        if (characterOutput) {
+            outputResults("Hybrid Laplace expansion with LU decomposition", result, elapsedTime);
+        }
+        return elapsedTime.count();
+    }
+
+    /**
+     * Metóda parallelLaplaceMethod reprezentuje paralelný Laplaceov rozvoj s plánovačom s kradnutím práce.
+     * Rozvoj minoru do hĺbky laplaceSpawnDepth_ je úloha, ktorá vytvorí potomkov pre nenulové prvky rozvíjaného riadku
+     * (stĺpca) a každého z nich pridá ako novú úlohu do zásobníka svojho vlákna, hlbšie minory sa počítajú sériovo.
+     * Nulové prvky robia strom nepravidelným, voľné vlákna si preto úlohy kradnú. Hodnota každého minoru sa uloží
+     * do jeho uzla a po dokončení všetkých úloh sa strom zredukuje v poradí potomkov, rovnako ako v sériovom rozvoji,
+     * takže výsledok je rovnaký pre ľubovoľný počet vlákien. Úplný rozvoj sa s metódou laplaceMethod zhoduje presne,
+     * variant so Sarusovým pravidlom sčítava listy každého sériového podstromu zvlášť, preto sa môže líšiť v zaokrúhlení.
+     *
+     * @tparam T dátový typ prvkov matice
+     * @param matrix referencia na maticu
+     * @param variant varianta laplaceovho rozvoja (úplný rozvoj alebo so Sarusovým pravidlom)
+     * @param characterOutput či sa majú vypísať výsledky do konzoly (boolean)
+     * @return čas trvania výpočtu
+     */
+    template <typename T>
+    double parallelLaplaceMethod(Matrix<T>& matrix, laplaceVariant variant, bool characterOutput) {
+        auto start = getCurrentTime();
+        ScratchArena& arena = beginScratch();
+        int matrixSize = matrix.getSize();
+        if (variant == LAPLACE_SUBSET_DP) {
+            std::cerr << "The subset DP is not available for the parallel Laplace expansion, the full Laplace expansion is used instead." << std::endl;
+            variant = FULL_LAPLACE_EXPANSION;
+        }
+
+        // uzly vytvárajú úlohy na rôznych vláknach, preto majú vlastnú arenu chránenú zámkom
+        ScratchArena& nodeArena = laplaceNodeArena();
+        nodeArena.reset();
+        std::mutex nodeMutex;
+        TaskGraph graph({ "Cofactor expansion (spawning)", "Serial subtree" });
+        laplaceNode<T> root;
+        root.size = matrixSize;
+        root.indices = nodeArena.allocate<int>(2 * static_cast<std::size_t>(matrixSize));
+        root.children = nullptr;
+        root.childCount = 0;
+        for (int i = 0; i < matrixSize; ++i) {
+            root.indices[i] = i;
+            root.indices[matrixSize + i] = i;
+        }
+        beginThreadPeaks(getTaskScheduler().getThreadCount());
+        graph.addTask(isLaplaceLeaf(root, 0) ? LAPLACE_SUBTREE_TASK : LAPLACE_EXPANSION_TASK, [this, &graph, &matrix, &root, &nodeArena, &nodeMutex, variant] {
+            expandLaplaceNode(graph, matrix, root, 0, variant, nodeArena, nodeMutex);
+        });
+        getTaskScheduler().execute(graph);
+        T result = reduceLaplaceNode(root);
+        auto end = getCurrentTime();
+
+        std::chrono::duration<double> elapsedTime = end - start;        // čas trvania výpočtu v sekundách
+        peakScratchBytes_ = arena.getPeakBytes() + nodeArena.getPeakBytes() + getWorkerPeakBytes();
+        recordResult(result);
+        if (characterOutput) {
+            switch (variant) {
+                case FULL_LAPLACE_EXPANSION: outputResults("Parallel full Laplace expansion", result, elapsedTime); break;
+                case LAPLACE_RULE_OF_SARRUS: outputResults("Parallel Laplace expansion with Rule of Sarrus", result, elapsedTime); break;
+                default: std::cerr << "Invalid variant of the Laplace Expansion." << std::endl; break;
+            }
+            std::cout << graph.getTimingReport();
+        }
+        return elapsedTime.count();
+    }
+
+    /**
+     * Metóda batchDeterminantMethod vypočíta determinanty dávky malých matíc rovnakého stupňa.
+     * Matice sú uložené po zložkách (prvok (i, j) matice m je na indexe (i * size + j) * count + m), takže matice
+     * do stupňa SimdKernels::BATCH_MAX_SIZE počíta vektorizované jadro naraz v celom vektorovom registri.
+     * Väčšie matice (do stupňa STATIC_DETERMINANT_MAX_SIZE) sa počítajú jednotlivo rozvinutým jadrom StaticMatrix.
+     *
+     * @tparam T dátový typ prvkov matíc
+     * @param elements prvky matíc po zložkách (size * size * count prvkov)
+     * @param determinants výstupné pole determinantov (count prvkov)
+     * @param count počet matíc
+     * @param size stupeň matíc (1 až STATIC_DETERMINANT_MAX_SIZE)
+     * @param characterOutput či sa majú vypísať výsledky do konzoly (boolean)
+     * @return čas trvania výpočtu
+     */
+    template <typename T>
+    double batchDeterminantMethod(const T* elements, T* determinants, std::size_t count, int size, bool characterOutput) {
+        if (size < 1 || size > STATIC_DETERMINANT_MAX_SIZE) {
+            std::cerr << "The batched determinant supports matrices of size 1 to " << STATIC_DETERMINANT_MAX_SIZE << "." << std::endl;
+            return 0;
+        }
+        auto start = getCurrentTime();
+        if (size <= SimdKernels::BATCH_MAX_SIZE) {
+            SimdKernels::batchDeterminantKernel<T>()(elements, count, determinants, count, size);
+        } else {
+            for (std::size_t m = 0; m < count; ++m) {
+                determinants[m] = staticDeterminant<T>(size, [elements, count, size, m](int row, int column) {
+                    return elements[(row * size + column) * count + m];
+                });
+            }
+        }
+        auto end = getCurrentTime();
+        std::chrono::duration<double> elapsedTime = end - start;        // čas trvania výpočtu v sekundách
+        peakScratchBytes_ = 0;         // dávkový výpočet nepoužíva pomocnú pamäť
+
+        if (characterOutput) {
+            std::cout << "Determinants of " << count << " matrices of size " << size << " calculated in: " << elapsedTime << std::endl;
+            std::cout << "Throughput of the batched determinant: " << count / elapsedTime.count() << " determinants per second" << std::endl;
+        }
+        return elapsedTime.count();
+    }
+
+    /**
+     * Metóda batchLuMethod vypočíta determinanty dávky matíc rovnakého stupňa prekladaným LU rozkladom.
+     * Matice sú uložené po zložkách rovnako ako pri metóde batchDeterminantMethod. Po skupinách (toľko matíc, koľko prvkov
+     * má vektorový register) sa prekladane skopírujú do pomocnej pamäte vlákna a každá zložka vektora rozkladá inú maticu
+     * s vlastným výberom pivota (SimdKernels::batchLuKernel). Skupiny sa rozdelia medzi vlákna perzistentného poolu,
+     * posledná neúplná skupina sa doplní jednotkovými maticami.
+     *
+     * @tparam T dátový typ prvkov matíc
+     * @param elements prvky matíc po zložkách (size * size * count prvkov)
+     * @param determinants výstupné pole determinantov (count prvkov)
+     * @param count počet matíc
+     * @param size stupeň matíc
+     * @param characterOutput či sa majú vypísať výsledky do konzoly (boolean)
+     * @return čas trvania výpočtu
+     */
+    template <typename T>
+    double batchLuMethod(const T* elements, T* determinants, std::size_t count, int size, bool characterOutput) {
+        auto start = getCurrentTime();
+        ScratchArena& arena = beginScratch();
+        SimdKernels::BatchLuKernel<T> kernel = SimdKernels::batchLuKernel<T>();
+        int lanes = kernel.lanes;
+        int numberOfGroups = static_cast<int>((count + lanes - 1) / lanes);
+        std::size_t groupElements = static_cast<std::size_t>(size) * size * lanes;
+
+        beginThreadPeaks(getThreadPool().getThreadCount());
+        getThreadPool().parallelFor(0, numberOfGroups, [&](int firstGroup, int lastGroup, int thread) {
+            ScratchArena& localArena = ScratchArena::local();
+            ScratchScope scope(localArena);
+            T* group = localArena.allocate<T>(groupElements);
+            T* groupDeterminants = localArena.allocate<T>(lanes);
+            for (int g = firstGroup; g < lastGroup; ++g) {
+                std::size_t first = static_cast<std::size_t>(g) * lanes;
+                int groupSize = static_cast<int>(std::min<std::size_t>(lanes, count - first));      // najviac lanes matíc
+                for (int e = 0; e < size * size; ++e) {
+                    T identity = e % (size + 1) == 0 ? T(1) : T(0);     // prvok jednotkovej matice pre doplnenie skupiny
+                    for (int l = 0; l < lanes; ++l) {
+                        group[static_cast<std::size_t>(e) * lanes + l] = l < groupSize ? elements[static_cast<std::size_t>(e) * count + first + l] : identity;
+                    }
+                }
+                kernel.factor(group, groupDeterminants, size);
+                std::copy(groupDeterminants, groupDeterminants + groupSize, determinants + first);
+            }
+            recordThreadPeak(thread, scope);
+        });
+        auto end = getCurrentTime();
+        std::chrono::duration<double> elapsedTime = end - start;        // čas trvania výpočtu v sekundách
+        peakScratchBytes_ = arena.getPeakBytes() + getWorkerPeakBytes();
+
+        if (characterOutput) {
+            std::cout << "Determinants of " << count << " matrices of size " << size << " calculated in: " << elapsedTime << std::endl;
+            std::cout << "Throughput of the interleaved batched LU decomposition: " << count / elapsedTime.count() << " determinants per second" << std::endl;
+        }
+        return elapsedTime.count();
+    }
+
+    /**
+     * Setter pre šírku bloku stĺpcov blokovej LU dekompozície.
+     *
+     * @param blockSize šírka bloku (aspoň 1)
+     */
+    void setLuBlockSize(int blockSize) {
+        luBlockSize_ = std::max(blockSize, 1);
+    }
+
+    /**
+     * Setter pre hĺbku rozvoja, do ktorej paralelný Laplaceov rozvoj vytvára úlohy.
+     *
+     * @param depth hĺbka (0 znamená sériový výpočet v jednej úlohe)
+     */
+    void setLaplaceSpawnDepth(int depth) {
+        laplaceSpawnDepth_ = std::max(depth, 0);
+    }
+
+    /**
+     * Setter pre stupeň minoru, od ktorého hybridný Laplaceov rozvoj pokračuje LU rozkladom.
+     *
+     * @param cutoff stupeň minoru (aspoň 1)
+     */
+    void setHybridCutoff(int cutoff) {
+        hybridCutoff_ = std::max(cutoff, 1);
+    }
+
+    /**
+     * Getter pre stupeň minoru, od ktorého hybridný Laplaceov rozvoj pokračuje LU rozkladom.
+     *
+     * @return stupeň minoru
+     */
+    int getHybridCutoff() const {
+        return hybridCutoff_;
+    }
+
+    /**
+     * Setter pre počet vlákien paralelných algoritmov. Pool vlákien a plánovač sa pri zmene vytvoria znovu.
+     *
+     * @param threadCount počet vlákien (aspoň 1)
+     */
+    void setThreadCount(int threadCount) {
+        threadCount = std::max(threadCount, 1);
+        if (threadCount != threadCount_) {
+            threadCount_ = threadCount;
+            threadPool_.reset();
+            taskScheduler_.reset();
+        }
+    }
+
+    /**
+     * Getter pre počet vlákien paralelných algoritmov.
+     *
+     * @return počet vlákien
+     */
+    int getThreadCount() const {
+        return threadCount_;
+    }
+
+    /**
+     * Setter pre veľkosť podmatice, pod ktorou paralelné algoritmy pokračujú sériovo.
+     *
+     * @param cutoff veľkosť podmatice
+     */
+    void setParallelCutoff(int cutoff) {
+        parallelCutoff_ = std::max(cutoff, 1);
+    }
+
+    /**
+     * Metóda getDefaultThreadCount vráti predvolený počet vlákien (počet hardvérových vlákien procesora).
+     *
+     * @return predvolený počet vlákien
+     */
+    static int getDefaultThreadCount() {
+        return std::max(static_cast<int>(std::thread::hardware_concurrency()), 1);
+    }
+
+    /**
+     * Getter pre maximum pomocnej pamäte použitej posledným výpočtom.
+     *
+     * @return maximum pomocnej pamäte v bajtoch
+     */
+    std::size_t getPeakScratchBytes() const {
+        return peakScratchBytes_;
+    }
+
+    /**
+     * Setter pre maximum pomocnej pamäte posledného výpočtu, ktorý prebehol mimo tejto inštancie
+     * (napr. bloky počítané inými inštanciami algoritmov alebo výpočet bez pomocnej pamäte).
+     *
+     * @param bytes maximum pomocnej pamäte v bajtoch
+     */
+    void setPeakScratchBytes(std::size_t bytes) {
+        peakScratchBytes_ = bytes;
+    }
+
+    /**
+     * Getter pre determinant vypočítaný posledným výpočtom (presný výsledok prevedený na double).
+     *
+     * @return determinant posledného výpočtu
+     */
+    double getLastDeterminant() const {
+        return lastDeterminant_;
+    }
+
+    /**
+     * Getter pre presný determinant posledného výpočtu (platný, iba ak isLastResultExact vráti true).
+     *
+     * @return presný determinant posledného výpočtu
+     */
+    const BigInteger& getLastExactDeterminant() const {
+        return lastExactDeterminant_;
+    }
+
+    /**
+     * Metóda isLastResultExact zistí, či posledný výpočet dal presný celočíselný výsledok.
+     *
+     * @return či je výsledok posledného výpočtu presný (boolean)
+     */
+    bool isLastResultExact() const {
+        return lastResultExact_;
+    }
+
+    /**
+     * Metóda copySettings prevezme nastavenia metód (šírku bloku, počet vlákien, hranice prechodu na iný výpočet)
+     * z inej inštancie. Pool vlákien a plánovač sa neprenášajú.
+     *
+     * @param other inštancia, ktorej nastavenia sa prevezmú
+     */
+    void copySettings(const Algorithms& other) {
+        luBlockSize_ = other.luBlockSize_;
+        parallelCutoff_ = other.parallelCutoff_;
+        laplaceSpawnDepth_ = other.laplaceSpawnDepth_;
+        hybridCutoff_ = other.hybridCutoff_;
+        setThreadCount(other.threadCount_);
+    }
+
+private:
+    /**
+     * Metóda gaussElimination reprezentuje algoritmus Gaussovej eliminácie na výpočet determinantu štvorcovej matice.
+     * Matice do stupňa STATIC_DETERMINANT_MAX_SIZE sa počítajú rozvinutým jadrom na zásobníku (StaticMatrix).
+     *
+     * @tparam T dátový typ prvkov matice
+     * @param matrix referencia na maticu
+     * @param arena pomocná pamäť
+     * @param parallel či sa má úprava riadkov rozdeliť medzi vlákna (boolean)
+     * @return hodnota determinantu
+     */
+    template <typename T>
+    T gaussElimination(Matrix<T>& matrix, ScratchArena& arena, bool parallel) {
+        int matrixSize = matrix.getSize();
+        if (matrixSize >= 1 && matrixSize <= STATIC_DETERMINANT_MAX_SIZE) {
+            return staticDeterminant<T>(matrixSize, [&matrix](int row, int column) { return matrix[row][column]; });
+        }
+        T* pivots = arena.allocate<T>(matrixSize);
+        int numberOfPivots = 0;
+        T pivot;
+        T result = 1;
+        T delta = std::numeric_limits<T>::min();
+        SimdKernels::RowUpdateKernel<T> rowUpdate = SimdKernels::rowUpdateKernel<T>();
+
+        for (int i = 0; i < matrixSize; ++i) {
+            // nájdenie pivota
+            pivot = 0;
+            for (int j = i; j < matrixSize; ++j) {
+                if (matrix[j][i] != 0) {
+                    if (j != i) {
+                        std::swap(matrix[i], matrix[j]);    // výmena riadkov
+                        result *= (-1);                     // zmena znamienka determinantu
+                    }
+                    pivot = matrix[i][i];
+                    pivots[numberOfPivots++] = pivot;
+                    break;
+                }
+            }
+
+            if (pivot == 0) {
+                result = 0;
+                break;
+            }
+
+            // úprava riadkov pod pivotom (vektorizované jadro zároveň nastaví malé hodnoty blízke nule na 0)
+            auto updateRows = [&](int firstRow, int lastRow) {
+                for (int j = firstRow; j < lastRow; ++j) {
+                    T number = -matrix[j][i];
+                    if (number != 0) {
+                        rowUpdate(matrix[j] + i, matrix[i] + i, number / pivot, delta, matrixSize - i);
+                    }
+                }
+            };
+            if (parallel && matrixSize - i > parallelCutoff_) {
+                getThreadPool().parallelFor(i + 1, matrixSize, updateRows);   // riadky pod pivotom sú navzájom nezávislé
+            } else {
+                updateRows(i + 1, matrixSize);
+            }
+        }
+
+        // vynásobenie pivotov
+        if (result != 0) {
+            for (int i = 0; i < numberOfPivots; ++i) {
+                result *= pivots[i];
+            }
+        }
+
+        return result;
+    }
+
+    /**
+     * Metóda luFactorization reprezentuje algoritmus LU dekompozície na výpočet determinantu štvorcovej matice.
+     * Matice do stupňa STATIC_DETERMINANT_MAX_SIZE sa počítajú rozvinutým jadrom na zásobníku (StaticMatrix),
+     * matice s hustotou pod SPARSE_DENSITY_THRESHOLD sa prevedú na riedke a počítajú riedkym LU rozkladom.
+     *
+     * @tparam T dátový typ prvkov matice
+     * @param matrix referencia na maticu
+     * @param arena pomocná pamäť
+     * @return hodnota determinantu
+     */
+    template <typename T>
+    T luFactorization(Matrix<T>& matrix, ScratchArena& arena) {
+        int matrixSize = matrix.getSize();
+        if (matrixSize >= 1 && matrixSize <= STATIC_DETERMINANT_MAX_SIZE) {
+            return staticDeterminant<T>(matrixSize, [&matrix](int row, int column) { return matrix[row][column]; });
+        }
+        std::size_t nonzeros = 0;
+        for (int i = 0; i < matrixSize; ++i) {
+            nonzeros += matrixSize - std::count(matrix[i], matrix[i] + matrixSize, T(0));
+        }
+        if (nonzeros < SPARSE_DENSITY_THRESHOLD * matrixSize * matrixSize) {
+            return sparseLuFactorization(matrix, arena);
+        }
+        T result = 1;
+        // matice L a U sú uložené po riadkoch v pomocnej pamäti, prvok (i, j) je na indexe i * matrixSize + j
+        T* L = arena.allocate<T>(static_cast<std::size_t>(matrixSize) * matrixSize);
+        T* U = arena.allocate<T>(static_cast<std::size_t>(matrixSize) * matrixSize);
+        T* diagonalElements = arena.allocate<T>(matrixSize);
+        int numberOfDiagonalElements = 0;
+        T sum;
+
+        // usporiadanie riadkov matice, aby na diagonále neboli 0
+        for (int i = 0; i < matrixSize; ++i) {
+            for (int j = i; j < matrixSize; ++j) {
+                if (matrix[j][i] != 0) {
+                    if (j != i) {
+                        std::swap(matrix[i], matrix[j]);    // výmena riadkov
+                        result *= (-1);                     // zmena znamienka determinantu
+                    }
+                    break;
+                }
+            }
+        }
+
+        for (int i = 0; i < matrixSize; ++i) {
+            // výpočet prvkov matice U
+            for (int j = i; j < matrixSize; ++j) {
+                sum = 0;
+                for (int k = 0; k < i; ++k) {
+                    sum += L[i * matrixSize + k] * U[k * matrixSize + j];
+                }
+                U[i * matrixSize + j] = matrix[i][j] - sum;
+            }
+
+            // kontrola, či sa nenachádza na diagonále U nula
+            if(U[i * matrixSize + i] == 0) {
+                result = 0;
+                break;
+            }
+            diagonalElements[numberOfDiagonalElements++] = U[i * matrixSize + i];
+
+            // výpočet prvkov matice L
+            for (int j = i; j < matrixSize; ++j) {
+                if (j == i) {
+                    L[i * matrixSize + i] = 1;
+                } else {
+                    sum = 0;
+                    for (int k = 0; k < i; ++k) {
+                        sum += L[j * matrixSize + k] * U[k * matrixSize + i];
+                    }
+                    L[j * matrixSize + i] = (matrix[j][i] - sum) / U[i * matrixSize + i];
+                }
+            }
+        }
+
+        // vynásobenie diagonálnych prvkov matice U
+        if (result != 0) {
+            for (int i = 0; i < numberOfDiagonalElements; ++i) {
+                result *= diagonalElements[i];
+            }
+        }
+
+        return result;
+    }
+
+    /**
+     * Metóda sparseLuFactorization vypočíta determinant riedkej matice riedkym LU rozkladom s Markowitzovou pivotizáciou.
+     *
+     * @tparam T dátový typ prvkov matice
+     * @param matrix referencia na riedku maticu
+     * @param arena pomocná pamäť
+     * @return hodnota determinantu
+     */
+    template <typename T>
+    T sparseLuFactorization(const SparseMatrix<T>& matrix, ScratchArena& arena) {
+        return sparseLuFactorization(matrix.getSize(), matrix.getRowStarts(), matrix.getColumnIndices(), matrix.getValues(), arena);
+    }
+
+    /**
+     * Metóda sparseLuFactorization uloží nenulové prvky hustej matice vo formáte CSR do pomocnej pamäte (bez riedkej matice
+     * na halde) a vypočíta jej determinant riedkym LU rozkladom s Markowitzovou pivotizáciou.
+     *
+     * @tparam T dátový typ prvkov matice
+     * @param matrix referencia na hustú maticu
+     * @param arena pomocná pamäť
+     * @return hodnota determinantu
+     */
+    template <typename T>
+    T sparseLuFactorization(Matrix<T>& matrix, ScratchArena& arena) {
+        int matrixSize = matrix.getSize();
+        int* rowStarts = arena.allocate<int>(matrixSize + 1);
+        rowStarts[0] = 0;
+        for (int i = 0; i < matrixSize; ++i) {
+            rowStarts[i + 1] = rowStarts[i] + matrixSize - static_cast<int>(std::count(matrix[i], matrix[i] + matrixSize, T(0)));
+        }
+        int* columnIndices = arena.allocate<int>(rowStarts[matrixSize]);
+        T* values = arena.allocate<T>(rowStarts[matrixSize]);
+        for (int i = 0, k = 0; i < matrixSize; ++i) {
+            for (int j = 0; j < matrixSize; ++j) {
+                if (matrix[i][j] != 0) {
+                    columnIndices[k] = j;
+                    values[k++] = matrix[i][j];
+                }
+            }
+        }
+        return sparseLuFactorization(matrixSize, rowStarts, columnIndices, values, arena);
+    }
+
+    /**
+     * Metóda sparseLuFactorization vypočíta determinant riedkej matice vo formáte CSR riedkym LU rozkladom s Markowitzovou pivotizáciou.
+     * Zvyšná (aktívna) podmatica sa uchováva po riadkoch ako zoznamy nenulových prvkov a pre každý stĺpec sa eviduje
+     * počet prvkov a riadky, v ktorých sa nachádza. Pivot sa v každom kroku vyberie tak, aby eliminácia vytvorila čo
+     * najmenej nových nenulových prvkov (pozri selectMarkowitzPivot), a upravia sa iba riadky s prvkom v stĺpci pivota.
+     * Keď hustota zvyšnej podmatice presiahne SPARSE_DENSE_SWITCH, podmatica sa skopíruje do hustej matice a dopočíta
+     * husto (LU rozkladom s čiastočnou pivotizáciou). Determinant je súčin pivotov a znamienok permutácií riadkov a stĺpcov v poradí pivotov.
+     * Všetky zoznamy ležia v pomocnej pamäti (ScratchList), zoznam sa pri novom prvku (fill-in) presunie do väčšej pamäte areny.
+     *
+     * @tparam T dátový typ prvkov matice
+     * @param matrixSize stupeň matice
+     * @param rowStarts index prvého prvku každého riadku (matrixSize + 1 prvkov)
+     * @param columnIndices stĺpce nenulových prvkov
+     * @param values hodnoty nenulových prvkov
+     * @param arena pomocná pamäť
+     * @return hodnota determinantu
+     */
+    template <typename T>
+    T sparseLuFactorization(int matrixSize, const int* rowStarts, const int* columnIndices, const T* values, ScratchArena& arena) {
+        auto* rows = arena.allocate<ScratchList<sparseEntry<T>>>(matrixSize);    // nenulové prvky aktívnych riadkov
+        auto* columnRows = arena.allocate<ScratchList<int>>(matrixSize);        // riadky s prvkom v stĺpci (aj už eliminované)
+        int* columnCounts = arena.allocate<int>(matrixSize);                    // počty prvkov stĺpcov v aktívnych riadkoch
+        bool* rowActive = arena.allocate<bool>(matrixSize);
+        bool* columnActive = arena.allocate<bool>(matrixSize);
+        int* rowOrder = arena.allocate<int>(matrixSize);                        // riadky v poradí pivotov
+        int* columnOrder = arena.allocate<int>(matrixSize);                     // stĺpce v poradí pivotov
+        std::fill(columnCounts, columnCounts + matrixSize, 0);
+        std::fill(rowActive, rowActive + matrixSize, true);
+        std::fill(columnActive, columnActive + matrixSize, true);
+        for (int k = 0; k < rowStarts[matrixSize]; ++k) {
+            columnCounts[columnIndices[k]]++;
+        }
+        for (int i = 0; i < matrixSize; ++i) {
+            new (&rows[i]) ScratchList<sparseEntry<T>>(arena, rowStarts[i + 1] - rowStarts[i]);
+            new (&columnRows[i]) ScratchList<int>(arena, columnCounts[i]);
+        }
+        for (int i = 0; i < matrixSize; ++i) {
+            for (int k = rowStarts[i]; k < rowStarts[i + 1]; ++k) {
+                rows[i].pushBack({ columnIndices[k], values[k] }, arena);
+                columnRows[columnIndices[k]].pushBack(i, arena);
+            }
+        }
+        std::size_t activeNonzeros = rowStarts[matrixSize];
+
+        // riadok pivota sa rozptýli do hustého poľa, stĺpce upravovaného riadku sa označia, aby sa našli nové prvky
+        T* pivotRowValues = arena.allocate<T>(matrixSize);
+        int* pivotRowMarks = arena.allocate<int>(matrixSize);
+        int* rowMarks = arena.allocate<int>(matrixSize);
+        std::fill(pivotRowMarks, pivotRowMarks + matrixSize, -1);
+        std::fill(rowMarks, rowMarks + matrixSize, -1);
+        int mark = 0;
+        T result = 1;
+        for (int step = 0; step < matrixSize; ++step) {
+            int remaining = matrixSize - step;
+            if (activeNonzeros >= SPARSE_DENSE_SWITCH * remaining * remaining) {
+                result *= denseSchurDeterminant(rows, matrixSize, rowActive, columnActive, step, rowOrder, columnOrder, arena);
+                break;
+            }
+            int pivotRow, pivotColumn;
+            T pivot;
+            if (!selectMarkowitzPivot(rows, columnRows, columnCounts, rowActive, columnActive, matrixSize, pivotRow, pivotColumn, pivot)) {
+                return 0;
+            }
+            result *= pivot;
+            rowOrder[step] = pivotRow;
+            columnOrder[step] = pivotColumn;
+            rowActive[pivotRow] = false;
+            columnActive[pivotColumn] = false;
+            for (const sparseEntry<T>& entry : rows[pivotRow]) {
+                columnCounts[entry.column]--;
+                pivotRowMarks[entry.column] = step;
+                pivotRowValues[entry.column] = entry.value;
+            }
+            activeNonzeros -= rows[pivotRow].size();
+
+            for (int row : columnRows[pivotColumn]) {
+                if (!rowActive[row]) {
+                    continue;
+                }
+                ScratchList<sparseEntry<T>>& target = rows[row];
+                sparseEntry<T>* found = std::find_if(target.begin(), target.end(), [pivotColumn](const sparseEntry<T>& entry) { return entry.column == pivotColumn; });
+                T factor = found->value / pivot;
+                *found = target.back();
+                target.popBack();
+                activeNonzeros--;
+                mark++;
+                for (sparseEntry<T>& entry : target) {
+                    if (pivotRowMarks[entry.column] == step) {
+                        entry.value -= factor * pivotRowValues[entry.column];
+                        rowMarks[entry.column] = mark;
+                    }
+                }
+                // prvky riadku pivota, ktoré upravovaný riadok nemal, sú nové nenulové prvky (fill-in)
+                for (const sparseEntry<T>& entry : rows[pivotRow]) {
+                    if (entry.column != pivotColumn && rowMarks[entry.column] != mark) {
+                        target.pushBack({ entry.column, -factor * entry.value }, arena);
+                        columnRows[entry.column].pushBack(row, arena);
+                        columnCounts[entry.column]++;
+                        activeNonzeros++;
+                    }
+                }
+            }
+            columnRows[pivotColumn].clear();
+            rows[pivotRow].clear();
+        }
+        return result * permutationSign(rowOrder, matrixSize, arena) * permutationSign(columnOrder, matrixSize, arena);
+    }
+
+    /**
+     * Metóda selectMarkowitzPivot vyberie pivot riedkeho LU rozkladu podľa Markowitzovho kritéria: prvok a_ij s najmenším
+     * súčinom (r_i - 1) * (c_j - 1), kde r_i a c_j sú počty prvkov jeho riadku a stĺpca, ohraničuje počet nových prvkov.
+     * Pivot sa hľadá v MARKOWITZ_COLUMNS stĺpcoch s najmenej prvkami a musí mať absolútnu hodnotu aspoň
+     * MARKOWITZ_PIVOT_THRESHOLD-násobok najväčšieho prvku stĺpca (kvôli numerickej stabilite).
+     *
+     * @tparam T dátový typ prvkov matice
+     * @param rows nenulové prvky aktívnych riadkov
+     * @param columnRows riadky s prvkom v stĺpci (eliminované riadky sa pri prechode odstránia)
+     * @param columnCounts počty prvkov stĺpcov v aktívnych riadkoch
+     * @param rowActive či je riadok aktívny
+     * @param columnActive či je stĺpec aktívny
+     * @param matrixSize stupeň matice
+     * @param pivotRow výstup: riadok pivota
+     * @param pivotColumn výstup: stĺpec pivota
+     * @param pivot výstup: hodnota pivota
+     * @return či sa pivot našiel (false znamená nulový stĺpec, determinant je 0)
+     */
+    template <typename T>
+    static bool selectMarkowitzPivot(const ScratchList<sparseEntry<T>>* rows, ScratchList<int>* columnRows, const int* columnCounts,
+                                     const bool* rowActive, const bool* columnActive, int matrixSize, int& pivotRow, int& pivotColumn, T& pivot) {
+        int candidates[MARKOWITZ_COLUMNS];
+        int candidateCount = 0;
+        for (int j = 0; j < matrixSize; ++j) {
+            if (!columnActive[j]) {
+                continue;
+            }
+            // zoradené vkladanie do krátkeho zoznamu stĺpcov s najmenej prvkami
+            int position = candidateCount < MARKOWITZ_COLUMNS ? candidateCount++ : MARKOWITZ_COLUMNS;
+            while (position > 0 && columnCounts[candidates[position - 1]] > columnCounts[j]) {
+                if (position < MARKOWITZ_COLUMNS) {
+                    candidates[position] = candidates[position - 1];
+                }
+                position--;
+            }
+            if (position < MARKOWITZ_COLUMNS) {
+                candidates[position] = j;
+            }
+        }
+
+        long long bestCost = std::numeric_limits<long long>::max();
+        pivotRow = -1;
+        for (int c = 0; c < candidateCount; ++c) {
+            int column = candidates[c];
+            ScratchList<int>& candidateRows = columnRows[column];
+            candidateRows.resize(static_cast<int>(std::remove_if(candidateRows.begin(), candidateRows.end(), [rowActive](int row) { return !rowActive[row]; }) - candidateRows.begin()));
+            T largest = 0;
+            for (int row : candidateRows) {
+                largest = std::max(largest, absoluteValue(rowValue(rows[row], column)));
+            }
+            if (largest == 0) {
+                return false;
+            }
+            for (int row : candidateRows) {
+                T value = rowValue(rows[row], column);
+                if (absoluteValue(value) < MARKOWITZ_PIVOT_THRESHOLD * largest) {
+                    continue;
+                }
+                long long cost = static_cast<long long>(rows[row].size() - 1) * (columnCounts[column] - 1);
+                if (cost < bestCost || (cost == bestCost && absoluteValue(value) > absoluteValue(pivot))) {
+                    bestCost = cost;
+                    pivotRow = row;
+                    pivotColumn = column;
+                    pivot = value;
+                }
+            }
+        }
+        return pivotRow >= 0;
+    }
+
+    /**
+     * Metóda rowValue nájde hodnotu prvku v zozname nenulových prvkov riadku.
+     *
+     * @tparam T dátový typ prvkov matice
+     * @param row nenulové prvky riadku
+     * @param column stĺpec prvku
+     * @return hodnota prvku (0, ak v riadku nie je)
+     */
+    template <typename T>
+    static T rowValue(const ScratchList<sparseEntry<T>>& row, int column) {
+        for (const sparseEntry<T>& entry : row) {
+            if (entry.column == column) {
+                return entry.value;
+            }
+        }
+        return 0;
+    }
+
+    /**
+     * Metóda denseSchurDeterminant skopíruje zvyšnú (aktívnu) podmaticu riedkeho LU rozkladu do hustej matice a vypočíta
+     * jej determinant LU rozkladom s čiastočnou pivotizáciou. Aktívne riadky a stĺpce sa pridajú na koniec poradia pivotov vzostupne.
+     *
+     * @tparam T dátový typ prvkov matice
+     * @param rows nenulové prvky aktívnych riadkov
+     * @param matrixSize stupeň matice
+     * @param rowActive či je riadok aktívny
+     * @param columnActive či je stĺpec aktívny
+     * @param pivotCount počet už vybraných pivotov
+     * @param rowOrder riadky v poradí pivotov (doplnia sa aktívne riadky)
+     * @param columnOrder stĺpce v poradí pivotov (doplnia sa aktívne stĺpce)
+     * @param arena pomocná pamäť
+     * @return determinant zvyšnej podmatice
+     */
+    template <typename T>
+    T denseSchurDeterminant(const ScratchList<sparseEntry<T>>* rows, int matrixSize, const bool* rowActive, const bool* columnActive,
+                            int pivotCount, int* rowOrder, int* columnOrder, ScratchArena& arena) {
+        int remaining = matrixSize - pivotCount;
+        int* columnPositions = arena.allocate<int>(matrixSize);
+        for (int j = 0, c = 0; j < matrixSize; ++j) {
+            if (columnActive[j]) {
+                columnPositions[j] = c;
+                columnOrder[pivotCount + c++] = j;
+            }
+        }
+        T* dense = arena.allocate<T>(static_cast<std::size_t>(remaining) * remaining);
+        std::fill(dense, dense + static_cast<std::size_t>(remaining) * remaining, T(0));
+        for (int i = 0, r = 0; i < matrixSize; ++i) {
+            if (rowActive[i]) {
+                for (const sparseEntry<T>& entry : rows[i]) {
+                    dense[static_cast<std::size_t>(r) * remaining + columnPositions[entry.column]] = entry.value;
+                }
+                rowOrder[pivotCount + r++] = i;
+            }
+        }
+        if (remaining <= STATIC_DETERMINANT_MAX_SIZE) {
+            return staticDeterminant<T>(remaining, [dense, remaining](int row, int column) { return dense[row * remaining + column]; });
+        }
+        return pivotedLuDeterminant(dense, remaining);
+    }
+
+    /**
+     * Metóda permutationSign vypočíta znamienko permutácie z počtu jej cyklov.
+     *
+     * @param permutation permutácia čísel 0 až size - 1
+     * @param size počet prvkov permutácie
+     * @param arena pomocná pamäť
+     * @return 1 pre párnu permutáciu, -1 pre nepárnu
+     */
+    static int permutationSign(const int* permutation, int size, ScratchArena& arena) {
+        ScratchScope scope(arena);
+        bool* visited = arena.allocate<bool>(size);
+        std::fill(visited, visited + size, false);
+        int transpositions = 0;
+        for (int i = 0; i < size; ++i) {
+            for (int j = i; !visited[j]; j = permutation[j]) {
+                visited[j] = true;
+                if (j != i) {
+                    transpositions++;
+                }
+            }
+        }
+        return transpositions % 2 == 0 ? 1 : -1;
+    }
+
+    /**
+     * Metóda bandLuFactorization vypočíta determinant pásovej matice LU rozkladom s čiastočnou pivotizáciou v čase
+     * O(n * kl * (kl + ku)), kde kl a ku sú dolná a horná šírka pásma. Pivot sa vyberá z kl + 1 riadkov pod diagonálou,
+     * výmenou riadkov sa horná šírka pásma zväčší najviac na kl + ku. V pamäti sú preto iba práve upravované riadky
+     * k až k + kl v kruhovom zásobníku (riadok r zaberá slot r mod (kl + 1) a obsahuje stĺpce r - kl až r + kl + ku),
+     * ďalší riadok sa načíta z pásovej matice, až keď naň príde rad. Súčin pivotov sa priebežne normalizuje
+     * (mantisa a dvojkový exponent), aby determinant matice stupňa 10^5 nepretiekol.
+     *
+     * @tparam T dátový typ prvkov matice
+     * @param matrix referencia na pásovú maticu
+     * @param arena pomocná pamäť
+     * @return determinant v tvare mantissa * 2^exponent
+     */
+    template <typename T>
+    scaledValue bandLuFactorization(const BandMatrix<T>& matrix, ScratchArena& arena) {
+        SimdKernels::RowUpdateKernel<T> rowUpdate = SimdKernels::rowUpdateKernel<T>();
+        int matrixSize = matrix.getSize();
+        int lower = matrix.getLowerBandwidth();
+        int upper = matrix.getUpperBandwidth();
+        int storedWidth = lower + upper + 1;            // prvky riadku v pásovej matici
+        int width = 2 * lower + upper + 1;              // prvky riadku v kruhovom zásobníku (s miestom pre rozšírenie pásma)
+        int slots = lower + 1;
+        T* ring = arena.allocate<T>(static_cast<std::size_t>(slots) * width);
+        auto rowOf = [&](int row) {
+            return ring + static_cast<std::size_t>(row % slots) * width;
+        };
+        auto loadRow = [&](int row) {
+            T* destination = rowOf(row);
+            std::copy(matrix.getRow(row), matrix.getRow(row) + storedWidth, destination);
+            std::fill(destination + storedWidth, destination + width, T(0));
+        };
+
+        scaledValue result = {1, 0};
+        for (int row = 0; row < std::min(lower, matrixSize); ++row) {
+            loadRow(row);
+        }
+        for (int k = 0; k < matrixSize; ++k) {
+            if (k + lower < matrixSize) {
+                loadRow(k + lower);
+            }
+            // prvok stĺpca c v riadku r je v zásobníku na indexe c - r + lower
+            int lastRow = std::min(k + lower, matrixSize - 1);
+            int lastColumn = std::min(k + lower + upper, matrixSize - 1);
+            int pivotRow = k;
+            for (int r = k + 1; r <= lastRow; ++r) {
+                if (absoluteValue(rowOf(r)[k - r + lower]) > absoluteValue(rowOf(pivotRow)[k - pivotRow + lower])) {
+                    pivotRow = r;
+                }
+            }
+            T* pivotRowElements = rowOf(k) + lower;     // stĺpce k až lastColumn
+            if (pivotRow != k) {
+                std::swap_ranges(pivotRowElements, pivotRowElements + lastColumn - k + 1, rowOf(pivotRow) + k - pivotRow + lower);
+                result.mantissa = -result.mantissa;
+            }
+            T pivot = pivotRowElements[0];
+            if (pivot == 0) {
+                return {0, 0};
+            }
+            int exponent;
+            result.mantissa = std::frexp(result.mantissa * static_cast<double>(pivot), &exponent);
+            result.exponent += exponent;
+            for (int r = k + 1; r <= lastRow; ++r) {
+                T* rowElements = rowOf(r) + k - r + lower;
+                T number = -rowElements[0];
+                if (number != 0) {
+                    rowUpdate(rowElements + 1, pivotRowElements + 1, number / pivot, T(0), lastColumn - k);
+                }
+            }
+        }
+        return result;
+    }
+
+    /**
+     * Metóda formatScaledValue vráti desiatkový zápis čísla mantissa * 2^exponent. Čísla v rozsahu typu double sa zapíšu
+     * bežne, ostatné v semilogaritmickom tvare (napr. 1.5e+40000).
+     *
+     * @param value číslo v tvare mantisa a dvojkový exponent
+     * @return desiatkový zápis čísla
+     */
+    static std::string formatScaledValue(const scaledValue& value) {
+        std::ostringstream stream;
+        stream.precision(std::cout.precision());
+        if (value.mantissa == 0 || std::abs(value.exponent) < std::numeric_limits<double>::max_exponent - 1) {
+            stream << std::ldexp(value.mantissa, static_cast<int>(value.exponent));
+            return stream.str();
+        }
+        double decimalExponent = std::log10(std::abs(value.mantissa)) + static_cast<double>(value.exponent) * std::log10(2.0);
+        double wholePart = std::floor(decimalExponent);
+        stream << (value.mantissa < 0 ? -1 : 1) * std::pow(10.0, decimalExponent - wholePart) << "e" << (wholePart < 0 ? "" : "+") << static_cast<long long>(wholePart);
+        return stream.str();
+    }
+
+    /**
+     * Metóda diagonalProduct vypočíta determinant diagonálnej alebo trojuholníkovej matice ako súčin prvkov diagonály.
+     *
+     * @tparam R dátový typ výsledku
+     * @tparam F typ zdroja prvkov
+     * @param matrixSize stupeň matice
+     * @param element zdroj prvkov s prístupom element(riadok, stĺpec)
+     * @return hodnota determinantu
+     */
+    template <typename R, typename F>
+    static R diagonalProduct(int matrixSize, F element) {
+        R result = 1;
+        for (int i = 0; i < matrixSize; ++i) {
+            result *= R(element(i, i));
+        }
+        return result;
+    }
+
+    /**
+     * Metóda tridiagonalContinuant vypočíta determinant trojdiagonálnej matice ako kontinuant:
+     * f(k) = a(k) * f(k - 1) - b(k - 1) * c(k - 1) * f(k - 2), kde a je diagonála, b nad ňou a c pod ňou (f(-1) = 1, f(-2) = 0).
+     *
+     * @tparam R dátový typ výsledku
+     * @tparam F typ zdroja prvkov
+     * @param matrixSize stupeň matice
+     * @param element zdroj prvkov s prístupom element(riadok, stĺpec)
+     * @return hodnota determinantu
+     */
+    template <typename R, typename F>
+    static R tridiagonalContinuant(int matrixSize, F element) {
+        R previous = 1;
+        R current = matrixSize > 0 ? R(element(0, 0)) : R(1);
+        for (int k = 1; k < matrixSize; ++k) {
+            R next = R(element(k, k)) * current - R(element(k - 1, k)) * R(element(k, k - 1)) * previous;
+            previous = std::move(current);
+            current = std::move(next);
+        }
+        return current;
+    }
+
+    /**
+     * Metóda hessenbergDeterminant vypočíta determinant hornej Hessenbergovej matice v čase O(n^2).
+     * Reálna matica sa eliminuje s čiastočnou pivotizáciou: v stĺpci k je pod diagonálou iba prvok riadku k + 1,
+     * stačí preto porovnať dva riadky a upraviť jeden, v pamäti sú iba tieto dva riadky (O(n)).
+     * Celočíselná matica sa počíta presne rekurenciou pre vedúce hlavné minory bez delenia:
+     * D(k) = h(k,k) D(k - 1) + sum_{i < k} (-1)^(k - i) h(i,k) h(i + 1,i) ... h(k,k - 1) D(i - 1).
+     *
+     * @tparam T dátový typ prvkov matice
+     * @tparam R dátový typ výsledku
+     * @tparam F typ zdroja prvkov
+     * @param matrixSize stupeň matice
+     * @param element zdroj prvkov s prístupom element(riadok, stĺpec)
+     * @param arena pomocná pamäť
+     * @return hodnota determinantu
+     */
+    template <typename T, typename R, typename F>
+    static R hessenbergDeterminant(int matrixSize, F element, ScratchArena& arena) {
+        if constexpr (std::is_integral_v<T>) {
+            std::vector<R> minors(matrixSize + 1);     // vedúce hlavné minory D(0) až D(n)
+            minors[0] = 1;
+            for (int k = 1; k <= matrixSize; ++k) {
+                R sum = R(element(k - 1, k - 1)) * minors[k - 1];
+                R subdiagonalProduct = 1;
+                for (int i = k - 1; i >= 1; --i) {
+                    subdiagonalProduct *= R(element(i, i - 1));
+                    if (subdiagonalProduct.isZero()) {
+                        break;      // nulový prvok pod diagonálou vynuluje aj všetky ďalšie členy
+                    }
+                    if (element(i - 1, k - 1) != 0) {
+                        R term = R(element(i - 1, k - 1)) * subdiagonalProduct * minors[i - 1];
+                        sum = (k - i) % 2 == 0 ? sum + term : sum - term;
+                    }
+                }
+                minors[k] = std::move(sum);
+            }
+            return minors[matrixSize];
+        } else {
+            SimdKernels::RowUpdateKernel<T> rowUpdate = SimdKernels::rowUpdateKernel<T>();
+            T* current = arena.allocate<T>(matrixSize);      // upravený riadok k
+            T* next = arena.allocate<T>(matrixSize);         // riadok k + 1
+            for (int j = 0; j < matrixSize; ++j) {
+                current[j] = element(0, j);
+            }
+            T result = 1;
+            for (int k = 0; k < matrixSize; ++k) {
+                if (k + 1 == matrixSize) {
+                    return result * current[k];
+                }
+                for (int j = k; j < matrixSize; ++j) {
+                    next[j] = element(k + 1, j);
+                }
+                if (absoluteValue(next[k]) > absoluteValue(current[k])) {
+                    std::swap(current, next);
+                    result = -result;
+                }
+                if (current[k] == 0) {
+                    return 0;
+                }
+                result *= current[k];
+                if (next[k] != 0) {
+                    rowUpdate(next + k + 1, current + k + 1, -next[k] / current[k], T(0), matrixSize - k - 1);
+                }
+                std::swap(current, next);
+            }
+            return result;
+        }
+    }
+
+    /**
+     * Metóda staticDeterminant vypočíta determinant malej matice (stupňa 1 až STATIC_DETERMINANT_MAX_SIZE)
+     * rozvinutým jadrom matice pevnej veľkosti, prvky sa skopírujú na zásobník.
+     *
+     * @tparam T dátový typ prvkov matice
+     * @tparam F typ zdroja prvkov
+     * @param matrixSize stupeň matice
+     * @param element zdroj prvkov s prístupom element(riadok, stĺpec)
+     * @return hodnota determinantu
+     */
+    template <typename T, typename F>
+    static T staticDeterminant(int matrixSize, const F& element) {
+        switch (matrixSize) {
+            case 1: return StaticMatrix<T, 1>(element).determinant();
+            case 2: return StaticMatrix<T, 2>(element).determinant();
+            case 3: return StaticMatrix<T, 3>(element).determinant();
+            case 4: return StaticMatrix<T, 4>(element).determinant();
+            case 5: return StaticMatrix<T, 5>(element).determinant();
+            case 6: return StaticMatrix<T, 6>(element).determinant();
+            case 7: return StaticMatrix<T, 7>(element).determinant();
+            default: return StaticMatrix<T, STATIC_DETERMINANT_MAX_SIZE>(element).determinant();
+        }
+    }
+
+    /**
+     * Metóda leibnizSubtree sčíta členy Leibnitzovho vzorca pre všetky permutácie so zadaným prefixom.
+     * Permutácie sa prechádzajú do hĺbky ako strom prefixov (v lexikografickom poradí): hĺbka d zodpovedá riadku d
+     * a pre každú hĺbku sa uchováva súčin vybraných prvkov a parita počtu inverzií, takže každý uzol stojí jedno násobenie.
+     * Výber stĺpca c v hĺbke d pridá toľko inverzií, koľko už použitých stĺpcov je väčších ako c (zistí sa z bitovej masky).
+     * Nulový prvok odreže celý podstrom, všetky permutácie s týmto prefixom majú nulový súčin.
+     *
+     * @tparam T dátový typ prvkov matice
+     * @param matrix referencia na maticu (iba na čítanie)
+     * @param prefix stĺpce vybrané v prvých prefixLength riadkoch
+     * @param prefixLength dĺžka prefixu
+     * @param arena pomocná pamäť
+     * @return súčet členov so zadaným prefixom
+     */
+    template <typename T>
+    static T leibnizSubtree(Matrix<T>& matrix, const int* prefix, int prefixLength, ScratchArena& arena) {
+        T result = 0;
+        int matrixSize = matrix.getSize();
+        int maskWords = (matrixSize + 63) / 64;
+        int* columns = arena.allocate<int>(matrixSize);                                 // vybraný stĺpec v každej hĺbke
+        T* products = arena.allocate<T>(matrixSize + 1);                                // súčin prvkov prefixu
+        unsigned char* parities = arena.allocate<unsigned char>(matrixSize + 1);        // parita počtu inverzií prefixu
+        unsigned long long* used = arena.allocate<unsigned long long>(maskWords);       // bitová maska použitých stĺpcov
+        std::fill(used, used + maskWords, 0ULL);
+
+        // súčin a parita zadaného prefixu
+        products[0] = 1;
+        parities[0] = 0;
+        for (int depth = 0; depth < prefixLength; ++depth) {
+            int column = prefix[depth];
+            if (matrix[depth][column] == 0) {
+                return 0;
+            }
+            products[depth + 1] = products[depth] * matrix[depth][column];
+            parities[depth + 1] = parities[depth] ^ static_cast<unsigned char>(countUsedAbove(used, maskWords, column) & 1);
+            used[column >> 6] |= 1ULL << (column & 63);
+        }
+        if (prefixLength == matrixSize) {
+            return parities[matrixSize] ? -products[matrixSize] : products[matrixSize];
+        }
+
+        columns[prefixLength] = -1;
+        int depth = prefixLength;
+        while (depth >= prefixLength) {
+            T* row = matrix[depth];
+            int column = columns[depth];
+            if (column >= 0) {
+                used[column >> 6] &= ~(1ULL << (column & 63));      // uvoľnenie predchádzajúceho stĺpca tejto hĺbky
+            }
+            // ďalší nepoužitý stĺpec s nenulovým prvkom (nulové prvky odrežú podstrom)
+            do {
+                column++;
+            } while (column < matrixSize && (((used[column >> 6] >> (column & 63)) & 1) != 0 || row[column] == 0));
+            if (column == matrixSize) {
+                depth--;                // návrat o úroveň vyššie
+                continue;
+            }
+            columns[depth] = column;
+
+            products[depth + 1] = products[depth] * row[column];
+            parities[depth + 1] = parities[depth] ^ static_cast<unsigned char>(countUsedAbove(used, maskWords, column) & 1);
+            used[column >> 6] |= 1ULL << (column & 63);
+
+            if (depth + 1 == matrixSize) {
+                // úplná permutácia, pri nepárnom počte inverzií je znamienko súčinu záporné
+                result += parities[matrixSize] ? -products[matrixSize] : products[matrixSize];
+            } else {
+                depth++;
+                columns[depth] = -1;
+            }
+        }
+        return result;
+    }
+
+    /**
+     * Metóda countUsedAbove zistí počet použitých stĺpcov väčších ako zadaný stĺpec (počet nových inverzií).
+     *
+     * @param used bitová maska použitých stĺpcov
+     * @param maskWords počet 64-bitových slov masky
+     * @param column stĺpec (nesmie byť použitý)
+     * @return počet použitých väčších stĺpcov
+     */
+    static int countUsedAbove(const unsigned long long* used, int maskWords, int column) {
+        int count = std::popcount(used[column >> 6] >> (column & 63));
+        for (int word = (column >> 6) + 1; word < maskWords; ++word) {
+            count += std::popcount(used[word]);
+        }
+        return count;
+    }
+
+    /**
+     * Metóda countZeros spočíta nuly v každom riadku a stĺpci matice.
+     *
+     * @tparam T dátový typ prvkov matice
+     * @param matrix pohľad na maticu (podmaticu)
+     * @param zeroCounts výstup: počty núl v riadkoch (prvých size prvkov) a v stĺpcoch (ďalších size prvkov)
+     */
+    template <typename T>
+    static void countZeros(const MatrixView<T>& matrix, int* zeroCounts) {
+        int matrixSize = matrix.getSize();
+        std::fill(zeroCounts, zeroCounts + 2 * matrixSize, 0);
+        for (int i = 0; i < matrixSize; ++i) {
+            for (int j = 0; j < matrixSize; ++j) {
+                if (matrix(i, j) == 0) {
+                    zeroCounts[i]++;
+                    zeroCounts[matrixSize + j]++;
+                }
+            }
+        }
+    }
+
+    /**
+     * Metóda updateZeroCounts vypočíta počty núl v riadkoch a stĺpcoch minoru bez zadaného riadku a stĺpca
+     * z počtov núl matice, stačí odčítať nuly vynechaného stĺpca (riadku), takže zložitosť je O(size).
+     *
+     * @tparam T dátový typ prvkov matice
+     * @param matrix pohľad na maticu (podmaticu)
+     * @param zeroCounts počty núl v riadkoch a stĺpcoch matice
+     * @param row vynechaný riadok
+     * @param column vynechaný stĺpec
+     * @param minorZeroCounts výstup: počty núl v riadkoch a stĺpcoch minoru
+     */
+    template <typename T>
+    static void updateZeroCounts(const MatrixView<T>& matrix, const int* zeroCounts, int row, int column, int* minorZeroCounts) {
+        int matrixSize = matrix.getSize();
+        for (int i = 0, k = 0; i < matrixSize; ++i) {
+            if (i != row) {
+                minorZeroCounts[k++] = zeroCounts[i] - (matrix(i, column) == 0);
+            }
+        }
+        for (int j = 0, k = matrixSize - 1; j < matrixSize; ++j) {
+            if (j != column) {
+                minorZeroCounts[k++] = zeroCounts[matrixSize + j] - (matrix(row, j) == 0);
+            }
+        }
+    }
+
+    /**
+     * Metóda chooseExpansionLine vyberie riadok alebo stĺpec s najväčším počtom núl, podľa ktorého sa matica rozvinie.
+     * Pri rovnakom počte núl má prednosť riadok (a spomedzi riadkov alebo stĺpcov ten s menším indexom).
+     *
+     * @param zeroCounts počty núl v riadkoch (prvých size prvkov) a v stĺpcoch (ďalších size prvkov)
+     * @param matrixSize stupeň matice
+     * @param byRow či sa má rozvíjať podľa riadku (výstupný parameter)
+     * @return index vybraného riadku alebo stĺpca
+     */
+    static int chooseExpansionLine(const int* zeroCounts, int matrixSize, bool& byRow) {
+        int indexOfRow = static_cast<int>(std::max_element(zeroCounts, zeroCounts + matrixSize) - zeroCounts);
+        int indexOfColumn = static_cast<int>(std::max_element(zeroCounts + matrixSize, zeroCounts + 2 * matrixSize) - zeroCounts) - matrixSize;
+        byRow = zeroCounts[indexOfRow] >= zeroCounts[matrixSize + indexOfColumn];
+        return byRow ? indexOfRow : indexOfColumn;
+    }
+
+    /**
+     * Metóda expandLaplaceNode vykoná úlohu uzla paralelného Laplaceovho rozvoja. List vypočíta sériovo,
+     * vnútorný uzol vytvorí potomkov pre nenulové prvky riadku (stĺpca) s najviac nulami a pridá ich ako nové úlohy.
+     *
+     * @tparam T dátový typ prvkov matice
+     * @param graph graf úloh
+     * @param matrix referencia na maticu (iba na čítanie)
+     * @param node uzol
+     * @param depth hĺbka uzla
+     * @param variant varianta laplaceovho rozvoja
+     * @param nodeArena arena uzlov stromu (potomkov a ich indexov)
+     * @param nodeMutex zámok areny uzlov
+     */
+    template <typename T>
+    void expandLaplaceNode(TaskGraph& graph, Matrix<T>& matrix, laplaceNode<T>& node, int depth, laplaceVariant variant, ScratchArena& nodeArena, std::mutex& nodeMutex) {
+        MatrixView<T> view(matrix.getRows(), node.indices, node.indices + node.size, node.size);
+        ScratchArena& arena = ScratchArena::local();
+        ScratchScope scope(arena);
+        if (isLaplaceLeaf(node, depth)) {
+            int* indexBuffer = arena.allocate<int>(2 * static_cast<std::size_t>(node.size) * node.size);
+            node.value = node.size > 1 ? laplaceExpansion(view, variant, indexBuffer) : view(0, 0);
+            node.expanded = false;
+            recordThreadPeak(WorkStealingScheduler::getCurrentWorker(), scope);
+            return;
+        }
+
+        int* zeroCounts = arena.allocate<int>(2 * static_cast<std::size_t>(node.size));
+        countZeros(view, zeroCounts);
+        bool byRow;
+        int indexOfLine = chooseExpansionLine(zeroCounts, node.size, byRow);
+        node.expanded = true;
+        node.childCount = node.size - zeroCounts[byRow ? indexOfLine : node.size + indexOfLine];
+        recordThreadPeak(WorkStealingScheduler::getCurrentWorker(), scope);
+        if (node.childCount == 0) {
+            node.children = nullptr;
+            return;
+        }
+        // potomkovia aj ich indexy sa vyhradia jednou alokáciou, ich adresy sa preto už nemenia
+        int childSize = node.size - 1;
+        int* childIndices;
+        {
+            std::lock_guard<std::mutex> lock(nodeMutex);
+            node.children = nodeArena.allocate<laplaceNode<T>>(node.childCount);
+            childIndices = nodeArena.allocate<int>(static_cast<std::size_t>(node.childCount) * 2 * childSize);
+        }
+        int childIndex = 0;
+        for (int i = 0; i < node.size; ++i) {
+            T element = byRow ? view(indexOfLine, i) : view(i, indexOfLine);
+            if (element == 0) {
+                continue;           // nulový prvok nepridáva do rozvoja nič
+            }
+            laplaceNode<T>& child = node.children[childIndex];
+            child.size = childSize;
+            child.element = element;
+            child.signExponent = indexOfLine + i;
+            child.indices = childIndices + static_cast<std::size_t>(childIndex) * 2 * childSize;
+            child.children = nullptr;
+            child.childCount = 0;
+            if (byRow) {
+                view.minor(indexOfLine, i, child.indices);
+            } else {
+                view.minor(i, indexOfLine, child.indices);
+            }
+            childIndex++;
+        }
+        for (int c = 0; c < node.childCount; ++c) {
+            laplaceNode<T>* childNode = node.children + c;
+            Task* task = graph.addTask(isLaplaceLeaf(*childNode, depth + 1) ? LAPLACE_SUBTREE_TASK : LAPLACE_EXPANSION_TASK, [this, &graph, &matrix, childNode, depth, variant, &nodeArena, &nodeMutex] {
+                expandLaplaceNode(graph, matrix, *childNode, depth + 1, variant, nodeArena, nodeMutex);
+            });
+            getTaskScheduler().spawn(task);
+        }
+    }
+
+    /**
+     * Metóda isLaplaceLeaf zistí, či sa uzol paralelného Laplaceovho rozvoja počíta sériovo.
+     *
+     * @tparam T dátový typ prvkov matice
+     * @param node uzol
+     * @param depth hĺbka uzla
+     * @return či je uzol listom stromu úloh (boolean)
+     */
+    template <typename T>
+    bool isLaplaceLeaf(const laplaceNode<T>& node, int depth) const {
+        return depth >= laplaceSpawnDepth_ || node.size <= 3;
+    }
+
+    /**
+     * Metóda reduceLaplaceNode vypočíta determinant minoru z hodnôt potomkov v rovnakom poradí a rovnakým výrazom
+     * ako sériový rozvoj.
+     *
+     * @tparam T dátový typ prvkov matice
+     * @param node uzol
+     * @return determinant minoru
+     */
+    template <typename T>
+    static T reduceLaplaceNode(const laplaceNode<T>& node) {
+        if (!node.expanded) {
+            return node.value;
+        }
+        T result = 0;
+        for (int c = 0; c < node.childCount; ++c) {
+            const laplaceNode<T>& child = node.children[c];
+            result += child.element * std::pow(-1, child.signExponent) * reduceLaplaceNode(child);
+        }
+        return result;
+    }
+
+    /**
+     * Metóda laplaceSubsetDp reprezentuje Laplaceov rozvoj s pamätaním minorov (dynamické programovanie nad podmnožinami stĺpcov).
+     * Minor f(S) tvoria prvé |S| riadky a stĺpce z množiny S. Rozvojom podľa posledného riadku minoru platí
+     * f(S) = sum_j (-1)^(|S| - 1 + j) * a[|S| - 1][s_j] * f(S \ {s_j}), kde s_j je j-tý najmenší stĺpec z S,
+     * takže každý minor sa vypočíta iba raz a determinant je f({0, ..., n-1}) v čase O(n * 2^n) namiesto O(n!).
+     * Uchovávajú sa iba dve úrovne tabuľky (minory stupňa k - 1 a k), podmnožiny úrovne sa prechádzajú v kolexikografickom
+     * poradí (Gosperov algoritmus) a index podmnožiny S \ {s_j} sa určí z kombinatorickej číselnej sústavy.
+     *
+     * @tparam T dátový typ prvkov matice
+     * @param matrix referencia na maticu
+     * @param arena pomocná pamäť
+     * @return hodnota determinantu
+     */
+    template <typename T>
+    T laplaceSubsetDp(Matrix<T>& matrix, ScratchArena& arena) {
+        int matrixSize = matrix.getSize();
+        // kombinačné čísla C(e, i) pre e, i <= n (C(e, i) = 0 pre i > e)
+        long long* binomials = arena.allocate<long long>(static_cast<std::size_t>(matrixSize + 1) * (matrixSize + 1));
+        for (int e = 0; e <= matrixSize; ++e) {
+            for (int i = 0; i <= matrixSize; ++i) {
+                long long* entry = binomials + e * (matrixSize + 1) + i;
+                *entry = i == 0 ? 1 : (e == 0 ? 0 : binomials[(e - 1) * (matrixSize + 1) + i - 1] + binomials[(e - 1) * (matrixSize + 1) + i]);
+            }
+        }
+        auto binomial = [&](int e, int i) { return binomials[e * (matrixSize + 1) + i]; };
+
+        long long levelSize = static_cast<long long>(largestBinomial(matrixSize));
+        T* previous = arena.allocate<T>(levelSize);         // minory stupňa k - 1
+        T* current = arena.allocate<T>(levelSize);          // minory stupňa k
+        int* elements = arena.allocate<int>(matrixSize);    // stĺpce aktuálnej podmnožiny vzostupne
+        previous[0] = 1;                                    // determinant prázdneho minoru
+
+        for (int k = 1; k <= matrixSize; ++k) {
+            T* row = matrix[k - 1];
+            unsigned long long subset = (1ULL << k) - 1;
+            unsigned long long end = 1ULL << matrixSize;
+            long long rank = 0;                             // poradie podmnožiny v kolexikografickom poradí
+            while (subset < end) {
+                long long lowerRank = 0;                    // príspevok stĺpcov pred s_j k indexu S \ {s_j}
+                long long upperRank = 0;                    // príspevok stĺpcov za s_j k indexu S \ {s_j}
+                int count = 0;
+                for (unsigned long long rest = subset; rest != 0; rest &= rest - 1) {
+                    elements[count] = std::countr_zero(rest);
+                    upperRank += binomial(elements[count], count);
+                    count++;
+                }
+                T value = 0;
+                for (int j = 0; j < k; ++j) {
+                    int column = elements[j];
+                    upperRank -= binomial(column, j);
+                    if (row[column] != 0) {
+                        T minor = previous[lowerRank + upperRank];
+                        if (minor != 0) {
+                            T term = row[column] * minor;
+                            value += ((k - 1 + j) & 1) ? -term : term;
+                        }
+                    }
+                    lowerRank += binomial(column, j + 1);
+                }
+                current[rank++] = value;
+
+                // ďalšia podmnožina s rovnakým počtom prvkov (Gosperov algoritmus)
+                unsigned long long lowest = subset & (0 - subset);
+                unsigned long long ripple = subset + lowest;
+                subset = (((ripple ^ subset) >> 2) / lowest) | ripple;
+            }
+            std::swap(previous, current);
+        }
+        return previous[0];
+    }
+
+    /**
+     * Metóda largestBinomial vypočíta najväčšie kombinačné číslo C(n, n/2) (počet minorov najväčšej úrovne).
+     *
+     * @param n stupeň matice
+     * @return kombinačné číslo (ako double, aby pri veľkých n nepretieklo)
+     */
+    static double largestBinomial(int n) {
+        double result = 1;
+        for (int i = 1; i <= n / 2; ++i) {
+            result = result * (n - n / 2 + i) / i;
+        }
+        return std::round(result);
+    }
+
+    /**
+     * Metóda laplaceExpansion reprezentuje algoritmus Laplaceovho rozvoja na výpočet determinantu štvorcovej matice.
+     * Podmatice sú reprezentované pohľadmi na pôvodnú maticu, zoznamy ich indexov sa zapisujú do pamäte indexBuffer,
+     * kde každá úroveň rekurzie používa vlastný úsek, takže rekurzia nealokuje pamäť ani nekopíruje prvky matice.
+     * Počty núl v riadkoch a stĺpcoch sa spočítajú raz a pre podmatice sa iba upravujú.
+     * Vo variante so Sarusovým pravidlom sa listy (minory stupňa 3) zbierajú do zásobníka a vyhodnocujú vektorovo.
+     *
+     * @tparam T dátový typ prvkov matice
+     * @param matrix pohľad na maticu (podmaticu)
+     * @param variant varianta laplaceovho rozvoja
+     * @param indexBuffer pamäť pre zoznamy indexov podmatíc a počty núl (aspoň 2 * size * size prvkov)
+     * @return hodnota determinantu
+     */
+    template <typename T>
+    T laplaceExpansion(const MatrixView<T>& matrix, laplaceVariant variant, int* indexBuffer) {
+        int matrixSize = matrix.getSize();
+        int* zeroCounts = indexBuffer + matrixSize * (matrixSize - 1);
+        countZeros(matrix, zeroCounts);
+        if (variant == laplaceVariant::LAPLACE_RULE_OF_SARRUS && matrixSize >= 3) {
+            ScratchArena& arena = ScratchArena::local();
+            ScratchScope scope(arena);
+            sarrusLeaves<T> leaves = { arena.allocate<T>(9 * LAPLACE_LEAF_BATCH), arena.allocate<T>(LAPLACE_LEAF_BATCH),
+                                       arena.allocate<T>(LAPLACE_LEAF_BATCH), LAPLACE_LEAF_BATCH, 0, 0 };
+            collectSarrusLeaves(matrix, T(1), indexBuffer, zeroCounts, leaves);
+            flushSarrusLeaves(leaves);
+            return leaves.sum;
+        }
+        return laplaceExpansion(matrix, indexBuffer, zeroCounts);
+    }
+
+    /**
+     * Metóda collectSarrusLeaves rozvíja maticu rovnako ako úplný Laplaceov rozvoj, ale namiesto návratu hodnoty nesie
+     * koeficient minoru (súčin prvkov so znamienkami od koreňa) smerom dole. Determinant je súčet minorov stupňa 3
+     * vynásobených ich koeficientmi, minory sa preto iba pridajú do zásobníka a sčítajú sa po jeho vyhodnotení.
+     *
+     * @tparam T dátový typ prvkov matice
+     * @param matrix pohľad na maticu (podmaticu) stupňa aspoň 3
+     * @param coefficient koeficient, ktorým sa násobí determinant matice
+     * @param indexBuffer pamäť pre zoznamy indexov podmatíc
+     * @param zeroCounts počty núl v riadkoch a stĺpcoch matice a pamäť pre počty núl podmatíc
+     * @param leaves zásobník listov
+     */
+    template <typename T>
+    void collectSarrusLeaves(const MatrixView<T>& matrix, T coefficient, int* indexBuffer, int* zeroCounts, sarrusLeaves<T>& leaves) {
+        int matrixSize = matrix.getSize();
+        if (matrixSize == 3) {
+            addSarrusLeaf(matrix, coefficient, leaves);
+            return;
+        }
+
+        bool byRow;
+        int indexOfLine = chooseExpansionLine(zeroCounts, matrixSize, byRow);
+        int nonzeroElements = matrixSize - zeroCounts[(byRow ? 0 : matrixSize) + indexOfLine];
+        int* nextIndexBuffer = indexBuffer + 2 * (matrixSize - 1);
+        int* nextZeroCounts = zeroCounts + 2 * matrixSize;
+        for (int i = 0; i < matrixSize && nonzeroElements > 0; ++i) {
+            int row = byRow ? indexOfLine : i;
+            int column = byRow ? i : indexOfLine;
+            T element = matrix(row, column);
+            if (element == 0) {
+                continue;
+            }
+            nonzeroElements--;
+            T minorCoefficient = coefficient * ((indexOfLine + i) % 2 == 0 ? element : -element);
+            MatrixView<T> newMatrix = matrix.minor(row, column, indexBuffer);
+            if (newMatrix.getSize() == 3) {
+                addSarrusLeaf(newMatrix, minorCoefficient, leaves);
+            } else {
+                updateZeroCounts(matrix, zeroCounts, row, column, nextZeroCounts);
+                collectSarrusLeaves(newMatrix, minorCoefficient, nextIndexBuffer, nextZeroCounts, leaves);
+            }
+        }
+    }
+
+    /**
+     * Metóda addSarrusLeaf pridá minor stupňa 3 do zásobníka listov, plný zásobník vyhodnotí.
+     *
+     * @tparam T dátový typ prvkov matice
+     * @param matrix pohľad na minor stupňa 3
+     * @param coefficient koeficient minoru
+     * @param leaves zásobník listov
+     */
+    template <typename T>
+    static void addSarrusLeaf(const MatrixView<T>& matrix, T coefficient, sarrusLeaves<T>& leaves) {
+        T* slot = leaves.elements + leaves.count;
+        for (int e = 0; e < 9; ++e) {
+            slot[static_cast<std::size_t>(e) * leaves.capacity] = matrix(e / 3, e % 3);
+        }
+        leaves.coefficients[leaves.count] = coefficient;
+        if (++leaves.count == leaves.capacity) {
+            flushSarrusLeaves(leaves);
+        }
+    }
+
+    /**
+     * Metóda flushSarrusLeaves vypočíta determinanty minorov v zásobníku vektorizovaným jadrom (Sarusovo pravidlo)
+     * a pripočíta ich skalárny súčin s koeficientmi k súčtu.
+     *
+     * @tparam T dátový typ prvkov matice
+     * @param leaves zásobník listov
+     */
+    template <typename T>
+    static void flushSarrusLeaves(sarrusLeaves<T>& leaves) {
+        SimdKernels::batchDeterminantKernel<T>()(leaves.elements, leaves.capacity, leaves.determinants, leaves.count, 3);
+        for (int m = 0; m < leaves.count; ++m) {
+            leaves.sum += leaves.coefficients[m] * leaves.determinants[m];
+        }
+        leaves.count = 0;
+    }
+
+    /**
+     * Metóda laplaceExpansion reprezentuje jednu úroveň rekurzie úplného Laplaceovho rozvoja so známymi počtami núl.
+     * Matica s nulovým riadkom alebo stĺpcom má determinant 0 bez ďalšieho rozvoja. Rozvíja sa iba podľa nenulových prvkov
+     * a ak má vybraný riadok (stĺpec) jediný nenulový prvok (napr. v trojuholníkovej matici), pokračuje sa jedinou podmaticou.
+     *
+     * @tparam T dátový typ prvkov matice
+     * @param matrix pohľad na maticu (podmaticu)
+     * @param indexBuffer pamäť pre zoznamy indexov podmatíc (aspoň size * (size - 1) prvkov)
+     * @param zeroCounts počty núl v riadkoch a stĺpcoch matice, za nimi pamäť pre počty núl podmatíc (spolu aspoň size * (size + 1) prvkov)
+     * @return hodnota determinantu
+     */
+    template <typename T>
+    T laplaceExpansion(const MatrixView<T>& matrix, int* indexBuffer, int* zeroCounts) {
+        int matrixSize = matrix.getSize();
+
+        // matica veľkosti 2 má uzavretý vzorec, ktorý sa zhoduje s jej rozvojom
+        if (matrixSize == 2) {
+            return StaticMatrix<T, 2>(matrix).determinant();
+        }
+
+        bool byRow;
+        int indexOfLine = chooseExpansionLine(zeroCounts, matrixSize, byRow);      // riadok alebo stĺpec, podľa ktorého sa rozvíja
+        int nonzeroElements = matrixSize - zeroCounts[(byRow ? 0 : matrixSize) + indexOfLine];
+        if (nonzeroElements == 0) {
+            return 0;
+        }
+
+        T result = 0;
+        int* nextIndexBuffer = indexBuffer + 2 * (matrixSize - 1);     // úsek pamäte pre ďalšiu úroveň rekurzie
+        int* nextZeroCounts = zeroCounts + 2 * matrixSize;
+        for (int i = 0; i < matrixSize && nonzeroElements > 0; ++i) {
+            int row = byRow ? indexOfLine : i;
+            int column = byRow ? i : indexOfLine;
+            T element = matrix(row, column);
+            if (element == 0) {
+                continue;
+            }
+            nonzeroElements--;
+            // vytvorenie pohľadu na podmaticu (o jeden stupeň menšiu)
+            MatrixView<T> newMatrix = matrix.minor(row, column, indexBuffer);
+            T minorDeterminant;
+            if (newMatrix.getSize() > 1) {
+                updateZeroCounts(matrix, zeroCounts, row, column, nextZeroCounts);
+                minorDeterminant = laplaceExpansion(newMatrix, nextIndexBuffer, nextZeroCounts);
+            } else {
+                minorDeterminant = newMatrix(0, 0);
+            }
+            result += element * std::pow(-1, indexOfLine + i) * minorDeterminant;
+        }
+        return result;
+    }
+
+    /**
+     * Metóda hybridLaplaceExpansion reprezentuje jednu úroveň rekurzie hybridného Laplaceovho rozvoja. Minor stupňa
+     * najviac cutoff sa vypočíta LU rozkladom (minorLuDeterminant), väčšia matica sa rozvinie rovnako ako v úplnom
+     * Laplaceovom rozvoji (podľa nenulových prvkov riadku alebo stĺpca s najviac nulami).
+     *
+     * @tparam T dátový typ prvkov matice
+     * @param matrix pohľad na maticu (podmaticu)
+     * @param indexBuffer pamäť pre zoznamy indexov podmatíc
+     * @param zeroCounts počty núl v riadkoch a stĺpcoch matice, za nimi pamäť pre počty núl podmatíc
+     * @param cutoff stupeň minoru, od ktorého sa pokračuje LU rozkladom
+     * @param luBuffer pamäť pre kópiu minoru (aspoň cutoff * cutoff prvkov, ak je cutoff väčší ako STATIC_DETERMINANT_MAX_SIZE)
+     * @return hodnota determinantu
+     */
+    template <typename T>
+    T hybridLaplaceExpansion(const MatrixView<T>& matrix, int* indexBuffer, int* zeroCounts, int cutoff, T* luBuffer) {
+        int matrixSize = matrix.getSize();
+        if (matrixSize <= cutoff) {
+            return minorLuDeterminant(matrix, luBuffer);
+        }
+
+        bool byRow;
+        int indexOfLine = chooseExpansionLine(zeroCounts, matrixSize, byRow);
+        int nonzeroElements = matrixSize - zeroCounts[(byRow ? 0 : matrixSize) + indexOfLine];
+        T result = 0;
+        int* nextIndexBuffer = indexBuffer + 2 * (matrixSize - 1);
+        int* nextZeroCounts = zeroCounts + 2 * matrixSize;
+        for (int i = 0; i < matrixSize && nonzeroElements > 0; ++i) {
+            int row = byRow ? indexOfLine : i;
+            int column = byRow ? i : indexOfLine;
+            T element = matrix(row, column);
+            if (element == 0) {
+                continue;
+            }
+            nonzeroElements--;
+            MatrixView<T> newMatrix = matrix.minor(row, column, indexBuffer);
+            updateZeroCounts(matrix, zeroCounts, row, column, nextZeroCounts);
+            T minorDeterminant = hybridLaplaceExpansion(newMatrix, nextIndexBuffer, nextZeroCounts, cutoff, luBuffer);
+            result += (indexOfLine + i) % 2 == 0 ? element * minorDeterminant : -element * minorDeterminant;
+        }
+        return result;
+    }
+
+    /**
+     * Metóda minorLuDeterminant vypočíta determinant minoru LU rozkladom s čiastočnou pivotizáciou. Minory do stupňa
+     * STATIC_DETERMINANT_MAX_SIZE počíta rozvinuté jadro StaticMatrix, väčšie sa skopírujú po riadkoch do pomocnej pamäte.
+     *
+     * @tparam T dátový typ prvkov matice
+     * @param matrix pohľad na minor
+     * @param luBuffer pamäť pre kópiu minoru (aspoň size * size prvkov pre minory väčšie ako STATIC_DETERMINANT_MAX_SIZE)
+     * @return hodnota determinantu
+     */
+    template <typename T>
+    static T minorLuDeterminant(const MatrixView<T>& matrix, T* luBuffer) {
+        int matrixSize = matrix.getSize();
+        if (matrixSize <= STATIC_DETERMINANT_MAX_SIZE) {
+            return staticDeterminant<T>(matrixSize, matrix);
+        }
+        for (int i = 0; i < matrixSize; ++i) {
+            for (int j = 0; j < matrixSize; ++j) {
+                luBuffer[i * matrixSize + j] = matrix(i, j);
+            }
+        }
+        return pivotedLuDeterminant(luBuffer, matrixSize);
+    }
+
+    /**
+     * Metóda pivotedLuDeterminant vypočíta determinant matice uloženej po riadkoch LU rozkladom s čiastočnou pivotizáciou
+     * (pivot s najväčšou absolútnou hodnotou v stĺpci), riadky upravuje vektorizované jadro. Prvky matice sa prepíšu.
+     *
+     * @tparam T dátový typ prvkov matice
+     * @param luBuffer prvky matice po riadkoch (size * size prvkov)
+     * @param matrixSize stupeň matice
+     * @return hodnota determinantu
+     */
+    template <typename T>
+    static T pivotedLuDeterminant(T* luBuffer, int matrixSize) {
+        SimdKernels::RowUpdateKernel<T> rowUpdate = SimdKernels::rowUpdateKernel<T>();
+        T result = 1;
+        for (int k = 0; k < matrixSize; ++k) {
+            int pivotRow = k;
+            for (int r = k + 1; r < matrixSize; ++r) {
+                if (absoluteValue(luBuffer[r * matrixSize + k]) > absoluteValue(luBuffer[pivotRow * matrixSize + k])) {
+                    pivotRow = r;
+                }
+            }
+            if (luBuffer[pivotRow * matrixSize + k] == 0) {
+                return 0;
+            }
+            if (pivotRow != k) {
+                std::swap_ranges(luBuffer + k * matrixSize + k, luBuffer + (k + 1) * matrixSize, luBuffer + pivotRow * matrixSize + k);
+                result = -result;
+            }
+            T pivot = luBuffer[k * matrixSize + k];
+            result *= pivot;
+            for (int r = k + 1; r < matrixSize; ++r) {
+                T number = -luBuffer[r * matrixSize + k];
+                if (number != 0) {
+                    rowUpdate(luBuffer + r * matrixSize + k + 1, luBuffer + k * matrixSize + k + 1, number / pivot, T(0), matrixSize - k - 1);
+                }
+            }
+        }
+        return result;
+    }
+
+    /**
+     * Metóda blockedLuTrailingUpdate upraví stĺpce columnStart..columnEnd-1 podmatice pod panelom: A22 = A22 - L21 * U12,
+     * kde L21 tvoria stĺpce panelu pod ním a U12 riadky panelu v upravovaných stĺpcoch.
+     * Podmatica sa prechádza po pásoch stĺpcov (aby U12 ostala v cache) a v nich po dlaždiciach,
+     * ktoré upravuje vektorizované jadro s medzisúčtami v registroch (SimdKernels::tileUpdateKernel).
+     *
+     * @tparam T dátový typ prvkov matice
+     * @param matrix referencia na maticu
+     * @param panelStart prvý stĺpec panelu
+     * @param panelEnd stĺpec za posledným stĺpcom panelu
+     * @param columnStart prvý upravovaný stĺpec
+     * @param columnEnd stĺpec za posledným upravovaným stĺpcom
+     */
+    template <typename T>
+    void blockedLuTrailingUpdate(Matrix<T>& matrix, int panelStart, int panelEnd, int columnStart, int columnEnd) {
+        constexpr int COLUMN_STRIP = 256;       // šírka pásu stĺpcov
+        constexpr int TILE_ROWS = SimdKernels::TILE_ROWS;
+        SimdKernels::TileUpdateKernel<T> tileUpdate = SimdKernels::tileUpdateKernel<T>();
+        int matrixSize = matrix.getSize();
+
+        for (int stripStart = columnStart; stripStart < columnEnd; stripStart += COLUMN_STRIP) {
+            int stripEnd = std::min(stripStart + COLUMN_STRIP, columnEnd);
+            int i = panelEnd;
+            for (; i + TILE_ROWS <= matrixSize; i += TILE_ROWS) {
+                int j = stripStart;
+                for (; j + tileUpdate.columns <= stripEnd; j += tileUpdate.columns) {
+                    tileUpdate.update(matrix.getRows(), i, panelStart, panelEnd, j);
+                }
+                // zvyšné stĺpce pásu, ktoré netvoria celú dlaždicu
+                for (int r = 0; r < TILE_ROWS; ++r) {
+                    blockedLuRowUpdate(matrix, i + r, panelStart, panelEnd, j, stripEnd);
+                }
+            }
+            // zvyšné riadky, ktoré netvoria celú dlaždicu
+            for (; i < matrixSize; ++i) {
+                blockedLuRowUpdate(matrix, i, panelStart, panelEnd, stripStart, stripEnd);
+            }
+        }
+    }
+
+    /**
+     * Metóda blockedLuRowUpdate upraví časť jedného riadku zvyšnej podmatice bez dlaždíc.
+     *
+     * @tparam T dátový typ prvkov matice
+     * @param matrix referencia na maticu
+     * @param row upravovaný riadok
+     * @param panelStart prvý stĺpec panelu
+     * @param panelEnd stĺpec za posledným stĺpcom panelu
+     * @param columnStart prvý upravovaný stĺpec
+     * @param columnEnd stĺpec za posledným upravovaným stĺpcom
+     */
+    template <typename T>
+    void blockedLuRowUpdate(Matrix<T>& matrix, int row, int panelStart, int panelEnd, int columnStart, int columnEnd) {
+        SimdKernels::RowUpdateKernel<T> rowUpdate = SimdKernels::rowUpdateKernel<T>();
+        T* target = matrix[row];
+        for (int p = panelStart; p < panelEnd; ++p) {
+            if (target[p] != 0 && columnEnd > columnStart) {
+                rowUpdate(target + columnStart, matrix[p] + columnStart, -target[p], 0, columnEnd - columnStart);
+            }
+        }
+    }
+
+    /**
+     * Metóda bareissElimination vykonáva kroky Bareissovho algoritmu od stavu state.
+     * Pri type s kontrolou pretečenia (64 a 128-bitové celé čísla) sa riadok počíta do pomocného buffera a zapíše sa až celý,
+     * takže pri pretečení ostanú riadky pred state.row upravené a ostatné neupravené a výpočet môže pokračovať v širšom type.
+     *
+     * @tparam W dátový typ, v ktorom prebieha výpočet
+     * @param rows tabuľka riadkov matice (výmeny riadkov sú výmenami ukazovateľov)
+     * @param matrixSize stupeň (veľkosť) matice
+     * @param state stav výpočtu, po skončení obsahuje znamienko a miesto prípadného pretečenia
+     * @param rowBuffer pomocný riadok dĺžky matrixSize (iba pre typy s kontrolou pretečenia)
+     * @return či výpočet skončil bez pretečenia (boolean)
+     */
+    template <typename W>
+    bool bareissElimination(W** rows, int matrixSize, bareissState& state, W* rowBuffer) {
+        constexpr bool checked = !std::is_floating_point_v<W> && !std::is_same_v<W, BigInteger>;
+        for (; state.step < matrixSize - 1; ++state.step, state.row = state.step + 1) {
+            int k = state.step;
+            // nájdenie pivota (pri celých číslach prvý nenulový, aby sa po obnovení výpočtu vybral ten istý)
+            int pivotRow = k;
+            for (int i = k; i < matrixSize; ++i) {
+                if constexpr (std::is_floating_point_v<W>) {
+                    if (absoluteValue(rows[i][k]) > absoluteValue(rows[pivotRow][k])) {
+                        pivotRow = i;
+                    }
+                } else if (rows[i][k] != 0) {
+                    pivotRow = i;
+                    break;
+                }
+            }
+            if (rows[pivotRow][k] == 0) {
+                state.singular = true;
+                return true;
+            }
+            if (pivotRow != k) {
+                std::swap(rows[k], rows[pivotRow]);     // výmena riadkov
+                state.sign = -state.sign;               // zmena znamienka determinantu
+            }
+
+            W pivot = rows[k][k];
+            W previousPivot = k == 0 ? W(1) : rows[k - 1][k - 1];
+            // v pohyblivej rádovej čiarke sa delí pred násobením, súčin dvoch minorov by pretiekol skôr ako determinant
+            W pivotRatio = std::is_floating_point_v<W> ? pivot / previousPivot : W(0);
+            for (int i = state.row; i < matrixSize; ++i) {
+                W* row = rows[i];
+                W factor = row[k];
+                W* target = checked ? rowBuffer : row;
+                for (int j = k + 1; j < matrixSize; ++j) {
+                    if constexpr (checked) {
+                        if (!bareissCombine(row[j], pivot, factor, rows[k][j], previousPivot, target[j])) {
+                            state.row = i;
+                            return false;
+                        }
+                    } else if constexpr (std::is_floating_point_v<W>) {
+                        target[j] = row[j] * pivotRatio - factor * (rows[k][j] / previousPivot);
+                    } else {
+                        target[j] = (row[j] * pivot - factor * rows[k][j]) / previousPivot;
+                    }
+                }
+                if constexpr (checked) {
+                    std::copy(rowBuffer + k + 1, rowBuffer + matrixSize, row + k + 1);
+                }
+            }
+        }
+        if (rows[matrixSize - 1][matrixSize - 1] == 0) {
+            state.singular = true;
+        }
+        return true;
+    }
+
+    /**
+     * Metóda bareissCombine vypočíta (value * pivot - factor * pivotRowValue) / previousPivot s kontrolou pretečenia.
+     *
+     * @tparam W celočíselný dátový typ
+     * @param result výsledok (platný iba ak nenastalo pretečenie)
+     * @return či výpočet prebehol bez pretečenia (boolean)
+     */
+    template <typename W>
+    static bool bareissCombine(W value, W pivot, W factor, W pivotRowValue, W previousPivot, W& result) {
+        W first, second, difference;
+        if (!checkedMultiply(value, pivot, first) || !checkedMultiply(factor, pivotRowValue, second) || !checkedSubtract(first, second, difference)) {
+            return false;
+        }
+        // jediný podiel, ktorý pretečie, je najmenšie číslo delené -1
+        if (previousPivot == -1 && difference == std::numeric_limits<W>::min()) {
+            return false;
+        }
+        result = difference / previousPivot;
+        return true;
+    }
+
+    /**
+     * Metóda checkedMultiply vynásobí dve celé čísla s kontrolou pretečenia.
+     *
+     * @tparam W celočíselný dátový typ
+     * @param result súčin (platný iba ak nenastalo pretečenie)
+     * @return či súčin nepretiekol (boolean)
+     */
+    template <typename W>
+    static bool checkedMultiply(W first, W second, W& result) {
+#if defined(__GNUC__) || defined(__clang__)
+        return !__builtin_mul_overflow(first, second, &result);
+#else
+        using U = std::make_unsigned_t<W>;
+        U firstMagnitude = first < 0 ? U(0) - U(first) : U(first);
+        U secondMagnitude = second < 0 ? U(0) - U(second) : U(second);
+        bool negative = (first < 0) != (second < 0);
+        U limit = U(std::numeric_limits<W>::max()) + (negative ? 1 : 0);
+        if (secondMagnitude != 0 && firstMagnitude > limit / secondMagnitude) {
+            return false;
+        }
+        U magnitude = firstMagnitude * secondMagnitude;
+        result = negative ? W(U(0) - magnitude) : W(magnitude);
+        return true;
+#endif
+    }
+
+    /**
+     * Metóda checkedSubtract odčíta dve celé čísla s kontrolou pretečenia.
+     *
+     * @tparam W celočíselný dátový typ
+     * @param result rozdiel (platný iba ak nenastalo pretečenie)
+     * @return či rozdiel nepretiekol (boolean)
+     */
+    template <typename W>
+    static bool checkedSubtract(W first, W second, W& result) {
+#if defined(__GNUC__) || defined(__clang__)
+        return !__builtin_sub_overflow(first, second, &result);
+#else
+        if ((second > 0 && first < std::numeric_limits<W>::min() + second) || (second < 0 && first > std::numeric_limits<W>::max() + second)) {
+            return false;
+        }
+        result = first - second;
+        return true;
+#endif
+    }
+
+    /**
+     * Metóda widenRows skopíruje maticu do pomocnej pamäte v širšom dátovom type, poradie riadkov ostáva zachované.
+     *
+     * @tparam W širší dátový typ
+     * @tparam N pôvodný dátový typ
+     * @param rows tabuľka riadkov pôvodnej matice
+     * @param matrixSize stupeň (veľkosť) matice
+     * @param arena pomocná pamäť
+     * @return tabuľka riadkov kópie
+     */
+    template <typename W, typename N>
+    static W** widenRows(N** rows, int matrixSize, ScratchArena& arena) {
+        W** wideRows = arena.allocate<W*>(matrixSize);
+        for (int i = 0; i < matrixSize; ++i) {
+            wideRows[i] = arena.allocate<W>(matrixSize);
+            std::copy(rows[i], rows[i] + matrixSize, wideRows[i]);
+        }
+        return wideRows;
+    }
+
+    /**
+     * Metóda bareissBigInteger dokončí Bareissov algoritmus v číslach BigInteger od stavu, v ktorom pretiekol užší typ.
+     * Prvky BigInteger nie sú triviálne kopírovateľné, preto sú uložené na halde a nezapočítavajú sa do pomocnej pamäte areny.
+     *
+     * @tparam N dátový typ, v ktorom výpočet pretiekol
+     * @param rows tabuľka riadkov rozpracovanej matice
+     * @param matrixSize stupeň (veľkosť) matice
+     * @param state stav výpočtu
+     * @return hodnota determinantu bez znamienka podľa výmen riadkov
+     */
+    template <typename N>
+    BigInteger bareissBigInteger(N** rows, int matrixSize, bareissState& state) {
+        std::vector<BigInteger> elements(static_cast<std::size_t>(matrixSize) * matrixSize);
+        std::vector<BigInteger*> bigRows(matrixSize);
+        for (int i = 0; i < matrixSize; ++i) {
+            bigRows[i] = elements.data() + static_cast<std::size_t>(i) * matrixSize;
+            for (int j = 0; j < matrixSize; ++j) {
+                bigRows[i][j] = BigInteger(rows[i][j]);
+            }
+        }
+        bareissElimination(bigRows.data(), matrixSize, state, static_cast<BigInteger*>(nullptr));
+        return state.singular ? BigInteger() : bigRows[matrixSize - 1][matrixSize - 1];
+    }
+
+    /**
+     * Metóda modularDeterminant vypočíta determinant celočíselnej matice modulo prvočíslo Gaussovou elimináciou.
+     * Pracovnú kópiu matice v Montgomeryho tvare berie z areny aktuálneho vlákna a pri skončení ju uvoľní.
+     *
+     * @tparam T celočíselný dátový typ prvkov matice
+     * @param matrix referencia na maticu (iba na čítanie)
+     * @param field aritmetika modulo prvočíslo
+     * @return determinant modulo prvočíslo
+     */
+    template <typename T>
+    static std::uint32_t modularDeterminant(Matrix<T>& matrix, const MontgomeryField& field) {
+        ScratchArena& arena = ScratchArena::local();
+        ScratchScope scope(arena);
+        int matrixSize = matrix.getSize();
+        long long prime = field.getPrime();
+        std::uint32_t** rows = arena.allocate<std::uint32_t*>(matrixSize);
+        for (int i = 0; i < matrixSize; ++i) {
+            rows[i] = arena.allocate<std::uint32_t>(matrixSize);
+            for (int j = 0; j < matrixSize; ++j) {
+                long long value = static_cast<long long>(matrix[i][j]) % prime;
+                rows[i][j] = field.toMontgomery(static_cast<std::uint32_t>(value < 0 ? value + prime : value));
+            }
+        }
+        SimdKernels::ModularRowUpdateKernel rowUpdate = SimdKernels::modularRowUpdateKernel();
+        std::uint32_t determinant = field.toMontgomery(1);
+        bool negative = false;
+
+        for (int k = 0; k < matrixSize; ++k) {
+            int pivotRow = k;
+            while (pivotRow < matrixSize && rows[pivotRow][k] == 0) {
+                pivotRow++;
+            }
+            if (pivotRow == matrixSize) {
+                return 0;
+            }
+            if (pivotRow != k) {
+                std::swap(rows[k], rows[pivotRow]);     // výmena riadkov
+                negative = !negative;                   // zmena znamienka determinantu
+            }
+            determinant = field.multiply(determinant, rows[k][k]);
+            std::uint32_t pivotInverse = field.inverse(rows[k][k]);
+            for (int i = k + 1; i < matrixSize; ++i) {
+                if (rows[i][k] != 0) {
+                    std::uint32_t factor = field.multiply(rows[i][k], pivotInverse);
+                    rowUpdate(rows[i] + k + 1, rows[k] + k + 1, factor, field.getPrime(), field.getNegatedInverse(), matrixSize - k - 1);
+                }
+            }
+        }
+        std::uint32_t result = field.fromMontgomery(determinant);
+        return negative && result != 0 ? field.getPrime() - result : result;
+    }
+
+    /**
+     * Metóda modularInverse vypočíta inverzný prvok modulo prvočíslo rozšíreným Euklidovým algoritmom.
+     *
+     * @param value nenulový zvyšok
+     * @param prime prvočíslo
+     * @return inverzný prvok z intervalu [0, prime)
+     */
+    static std::uint64_t modularInverse(std::uint64_t value, std::uint64_t prime) {
+        long long oldRemainder = static_cast<long long>(value), remainder = static_cast<long long>(prime);
+        long long oldCoefficient = 1, coefficient = 0;
+        while (remainder != 0) {
+            long long quotient = oldRemainder / remainder;
+            std::swap(oldRemainder, remainder);
+            remainder -= quotient * oldRemainder;
+            std::swap(oldCoefficient, coefficient);
+            coefficient -= quotient * oldCoefficient;
+        }
+        return static_cast<std::uint64_t>(oldCoefficient < 0 ? oldCoefficient + static_cast<long long>(prime) : oldCoefficient);
+    }
+
+    /**
+     * Metóda absoluteValue vráti absolútnu hodnotu prvku matice.
+     *
+     * @tparam T dátový typ prvkov matice
+     * @param value hodnota
+     * @return absolútna hodnota
+     */
+    template <typename T>
+    static T absoluteValue(T value) {
+        return value < 0 ? -value : value;
+    }
+
+    /**
+     * Getter pre pool vlákien. Pool sa vytvorí pri prvom použití a ostáva medzi výpočtami.
+     *
+     * @return referencia na pool vlákien
+     */
+    ThreadPool& getThreadPool() {
+        if (!threadPool_) {
+            threadPool_ = std::make_unique<ThreadPool>(threadCount_);
+        }
+        return *threadPool_;
+    }
+
+    /**
+     * Getter pre plánovač grafov úloh. Plánovač sa vytvorí pri prvom použití a ostáva medzi výpočtami.
+     *
+     * @return referencia na plánovač
+     */
+    WorkStealingScheduler& getTaskScheduler() {
+        if (!taskScheduler_) {
+            taskScheduler_ = std::make_unique<WorkStealingScheduler>(threadCount_);
+        }
+        return *taskScheduler_;
+    }
+
+    /**
+     * Metóda beginScratch pripraví pomocnú pamäť aktuálneho vlákna na nový výpočet.
+     * Po prvej replikácii danej veľkosti má arena dostatočnú kapacitu, takže ďalšie replikácie nealokujú pamäť.
+     *
+     * @return referencia na arenu aktuálneho vlákna
+     */
+    ScratchArena& beginScratch() {
+        ScratchArena& arena = ScratchArena::local();
+        arena.reset();
+        return arena;
+    }
+
+    /**
+     * Metóda laplaceNodeArena vráti arenu uzlov paralelného Laplaceovho rozvoja patriacu aktuálnemu vláknu.
+     * Je oddelená od areny ScratchArena::local, pretože volajúce vlákno počas výpočtu vykonáva úlohy
+     * s vlastnými rozsahmi ScratchScope, ktoré by uvoľnili uzly vytvorené inými vláknami.
+     *
+     * @return referencia na arenu uzlov
+     */
+    static ScratchArena& laplaceNodeArena() {
+        thread_local ScratchArena arena;
+        return arena;
+    }
+
+    /**
+     * Metóda beginThreadPeaks vynuluje maximá pomocnej pamäte vlákien pred paralelným výpočtom.
+     * Pamäť poľa maxím ostáva medzi výpočtami, takže sa pri rovnakom počte vlákien nealokuje.
+     *
+     * @param threadCount počet vlákien (vrátane volajúceho vlákna s indexom 0)
+     */
+    void beginThreadPeaks(int threadCount) {
+        threadPeakBytes_.assign(threadCount, 0);
+    }
+
+    /**
+     * Metóda recordThreadPeak započíta maximum pomocnej pamäte úlohy do maxima vlákna, ktoré ju vykonalo.
+     *
+     * @param thread index vlákna
+     * @param scope rozsah pomocnej pamäte úlohy
+     */
+    void recordThreadPeak(int thread, const ScratchScope& scope) {
+        threadPeakBytes_[thread] = std::max(threadPeakBytes_[thread], scope.getPeakBytes());
+    }
+
+    /**
+     * Metóda getWorkerPeakBytes vráti súčet maxím pomocnej pamäte pomocných vlákien. Úlohy volajúceho vlákna (index 0)
+     * používajú jeho arenu, sú preto už započítané v jej maxime.
+     *
+     * @return pomocná pamäť pomocných vlákien v bajtoch
+     */
+    std::size_t getWorkerPeakBytes() const {
+        std::size_t bytes = 0;
+        for (std::size_t thread = 1; thread < threadPeakBytes_.size(); ++thread) {
+            bytes += threadPeakBytes_[thread];
+        }
+        return bytes;
     }
 
     /**
@@ -388,6 +2983,28 @@ private:
         return std::chrono::system_clock::now();
     }
 
+    /**
+     * Metóda recordResult uloží výsledný determinant posledného výpočtu. Celočíselné výsledky (aj BigInteger) sa uložia presne.
+     *
+     * @tparam T dátový typ výsledku
+     * @param result výsledný determinant
+     */
+    template <typename T>
+    void recordResult(const T& result) {
+        if constexpr (std::is_same_v<T, BigInteger>) {
+            lastExactDeterminant_ = result;
+            lastDeterminant_ = result.toDouble();
+            lastResultExact_ = true;
+        } else if constexpr (std::is_integral_v<T>) {
+            lastExactDeterminant_ = BigInteger(result);
+            lastDeterminant_ = static_cast<double>(result);
+            lastResultExact_ = true;
+        } else {
+            lastDeterminant_ = static_cast<double>(result);
+            lastResultExact_ = false;
+        }
+    }
+
     /**
      * Metóda outputResults slúži na výpis výsledného determinantu matice a čas trvania daného výpočtu.
      *
@@ -400,6 +3017,7 @@ private:
     void outputResults(const std::string& methodName, T result, auto elapsedTime) {
         std::cout << "The determinant of the matrix is equal to: " << result << std::endl;
         std::cout << "Calculation duration of the " << methodName << ": " << elapsedTime << std::endl;
+        std::cout << "Peak scratch memory of the " << methodName << ": " << peakScratchBytes_ << " B" << std::endl;
     }
 };
 
@@ -3,25 +3,63 @@
 
 #include "FileReader.h"
 #include "Algorithms.h"
+#include "CostModel.h"
 #include "Generator.h"
 #include "FileWriter.h"
+#include "MatrixPool.h"
+#include "StructuralAnalysis.h"
+
+/**
+ * Štruktúra blockResult uchováva determinant jedného diagonálneho bloku (presne, ak ho metóda vypočítala presne).
+ */
+struct blockResult {
+    double value;           // determinant bloku
+    BigInteger exactValue;  // presný determinant bloku (iba ak exact)
+    bool exact;             // či je determinant bloku presný
+};
 
 /**
  * Trieda App je zodpovedná za beh celej aplikácie.
  */
 class App {
 private:
+    static constexpr int NUMBER_OF_METHODS = 17;    // počet výpočtových metód v menu (nasleduje voľba Exit)
+    static constexpr int BAREISS_METHOD = 9;        // metóda, ktorá počíta s celočíselnými maticami presne
+    static constexpr int MULTI_MODULAR_METHOD = 10; // metóda, ktorá počíta iba s celočíselnými maticami (presne)
+    static constexpr int HYBRID_LAPLACE_METHOD = 14;    // Laplaceov rozvoj, ktorý od zvoleného stupňa minoru pokračuje LU rozkladom
+    static constexpr int AUTO_METHOD = 15;          // automatický výber metódy podľa modelu ceny
+    static constexpr int SPARSE_LU_METHOD = 16;     // riedky LU rozklad (matica sa ukladá vo formáte CSR)
+    static constexpr int BAND_LU_METHOD = 17;       // pásový LU rozklad (matica sa ukladá po diagonálach pásma)
+    static constexpr int MAX_MATRIX_SIZE = 1000;            // najväčší stupeň generovanej hustej matice
+    static constexpr int MAX_BAND_MATRIX_SIZE = 1000000;    // najväčší stupeň generovanej pásovej matice
+    static constexpr int MAX_BAND_ELEMENTS = 50000000;      // najväčší počet uložených prvkov generovanej pásovej matice
+    static constexpr int BATCH_CLOSED_FORM_METHOD = 1;  // dávková metóda s uzavretými vzorcami (matice do stupňa 8)
+    static constexpr int BATCH_LU_METHOD = 2;           // dávková metóda s prekladaným LU rozkladom
+
     Algorithms algorithms_;     // algoritmy
     FileWriter fileWriter_;     // zapisovač
     FileReader fileReader_;     // čítač
+    CostModel costModel_;       // model ceny metód pre automatický výber
+    bool requireExact_;         // či automatický výber musí celočíselné matice počítať presne
+    int lastSelectedMethod_;    // metóda, ktorú automatický výber zvolil naposledy
+    laplaceVariant parallelLaplaceVariant_;     // varianta paralelného Laplaceovho rozvoja (úplný rozvoj alebo so Sarusovým pravidlom)
+    bool structuralCheck_;      // či sa pred výpočtom zisťuje štrukturálna singularita (párovanie riadkov a stĺpcov)
+    int structurallySingularCount_;     // počet matíc, ktorých determinant bol 0 už podľa štrukturálnej singularity
+    bool blockTriangular_;      // či sa matica pred výpočtom rozloží na diagonálne bloky blokového trojuholníkového tvaru
+    int lastBlockCount_;        // počet diagonálnych blokov naposledy rozloženej matice
+    std::unique_ptr<ThreadPool> blockPool_;         // pool vlákien pre paralelný výpočet blokov (vytvorí sa pri prvom použití)
+    std::vector<Algorithms> blockAlgorithms_;       // inštancie algoritmov pre vlákna počítajúce bloky
+    bool structureDetection_;   // či sa pred výpočtom rozpoznáva diagonálna, trojuholníková, trojdiagonálna a Hessenbergova matica
+    matrixStructure lastStructure_;     // rozloženie nenulových prvkov naposledy počítanej matice
 public:
     /**
      * Default konštruktor triedy.
      */
-    App() {
+    App() : costModel_("cost_model.csv"), requireExact_(true), lastSelectedMethod_(0), parallelLaplaceVariant_(LAPLACE_RULE_OF_SARRUS), structuralCheck_(false), structurallySingularCount_(0), blockTriangular_(false), lastBlockCount_(0), structureDetection_(false), lastStructure_(GENERAL_MATRIX) {
         algorithms_ = Algorithms();
         fileReader_ = FileReader();
         fileWriter_ = FileWriter();
+        registerCostCurves();
     }
 
     /**
@@ -30,11 +68,15 @@ public:
     void run() {
         unsigned int seed = std::chrono::system_clock::now().time_since_epoch().count(); // nastaví seed na základe systémového času pre vykonávanie experimentov
         while (true) {
-            int input = readIntInput("Choose the action [ '1' - experiment, '2' - calculate matrix, '3' - exit ].", 1, 3);
+            int input = readIntInput("Choose the action [ '1' - experiment, '2' - batched experiment, '3' - calculate matrix, '4' - calculate batch of matrices, '5' - exit ].", 1, 5);
             if (input == 1) {
                 specifyExperiment(seed);
             } else if (input == 2) {
+                specifyBatchExperiment(seed);
+            } else if (input == 3) {
                 calculateMatrixFromFile();
+            } else if (input == 4) {
+                calculateBatchFromFile();
             } else {
                 break;
             }
@@ -48,20 +90,36 @@ private:
      * @param seed seed pre generátory
      */
     void specifyExperiment(unsigned int seed) {
-        int method = readIntInput("Choose the method for the experiment [ '1' - Gauss Elimination, '2' - Leibniz Method, '3' - Full Laplace Expansion, '4' - Laplace Expansion + Rule of Sarrus, '5' - LU Decomposition, '6' - Exit ].", 1, 6);
-        if (method == 6) {
+        int method = readMethodInput("Choose the method for the experiment");
+        if (method > NUMBER_OF_METHODS) {
             return;
         }
-        int minSizeOfMatrix = readIntInput("Enter the minimum size of the matrix on which you want to perform replications [3-1000].", 3, 1000);
-        int maxSizeOfMatrix = readIntInput("Enter the maximum size of the matrix on which you want to perform replications [3-1000].", 3, 1000);
-        int multiplesOfMatrixSize = readIntInput("Enter the multiples of matrices size on which you want to perform replications [1-100].", 1, 100);
+        std::string methodSettings = configureMethod(method);
+        // pásová matica sa ukladá iba v pásme, preto môže mať aj stupeň, pre ktorý sa hustá matica nedá alokovať
+        int maxSize = method == BAND_LU_METHOD ? MAX_BAND_MATRIX_SIZE : MAX_MATRIX_SIZE;
+        int maxMultiple = maxSize / 10;
+        int minSizeOfMatrix = readIntInput("Enter the minimum size of the matrix on which you want to perform replications [3-" + std::to_string(maxSize) + "].", 3, maxSize);
+        int maxSizeOfMatrix = readIntInput("Enter the maximum size of the matrix on which you want to perform replications [3-" + std::to_string(maxSize) + "].", 3, maxSize);
+        int multiplesOfMatrixSize = readIntInput("Enter the multiples of matrices size on which you want to perform replications [1-" + std::to_string(maxMultiple) + "].", 1, maxMultiple);
         int numberOfReplications = readIntInput("Enter the number of the replications [1-10000].", 1, 10000);
         int seedSet = readIntInput("Do you want to set the seed? ['0' - no, '1' - yes].", 0, 1);
         if (seedSet == 1) {
             seed = readUnsignedIntInput("Enter the seed for the generator.", 0, std::numeric_limits<unsigned int>::max());
         }
         double zeroProbability = readDoubleInput("Enter the probability of zero elements in the matrix [0.0-1.0].", 0.0, 1.0);
-        int dataType = readIntInput("Choose the data type for generated elements [ '1' - double, '2' - float, '3' - int ].", 1, 3);
+        int largestSize = std::max(minSizeOfMatrix, maxSizeOfMatrix);
+        int bandwidth;
+        if (method == BAND_LU_METHOD) {
+            // pásová matica najväčšieho stupňa musí mať najviac MAX_BAND_ELEMENTS uložených prvkov, plné matice sa negenerujú
+            int maxBandwidth = std::min(largestSize - 1, (MAX_BAND_ELEMENTS / largestSize - 1) / 2);
+            bandwidth = readIntInput("Enter the bandwidth of the generated matrices (number of diagonals on each side of the main diagonal) [0-" + std::to_string(maxBandwidth) + "].", 0, maxBandwidth);
+        } else {
+            bandwidth = readIntInput("Enter the bandwidth of the generated matrices (number of diagonals on each side of the main diagonal) [0-" + std::to_string(largestSize - 1) + "] or '-1' for full matrices.", -1, largestSize - 1);
+        }
+        int dataType = 3;
+        if (method != MULTI_MODULAR_METHOD) {
+            dataType = readIntInput("Choose the data type for generated elements [ '1' - double, '2' - float, '3' - int ].", 1, 3);
+        }
 
         double minValue, maxValue;
         if (dataType == 3) {
@@ -74,17 +132,14 @@ private:
 
         std::string fileName = readFileNameInput("Enter the name of the file in the .csv format to save the results:", ".csv");
         fileWriter_.setOutputFile(fileName);
-        switch (method) {
-            case 1: fileWriter_.writeStringToFile("Gauss Elimination\n"); break;
-            case 2: fileWriter_.writeStringToFile("Leibniz method\n"); break;
-            case 3: fileWriter_.writeStringToFile("Full Laplace Expansion\n"); break;
-            case 4: fileWriter_.writeStringToFile("Laplace Expansion + Rule of Sarrus\n"); break;
-            default: fileWriter_.writeStringToFile("LU Decomposition\n"); break;
-        }
+        fileWriter_.writeStringToFile(getMethodName(method) + "\n");
+        fileWriter_.writeStringToFile(methodSettings);
         fileWriter_.writeStringToFile("Seed;" + std::to_string(seed) + "\n");
+        fileWriter_.writeStringToFile("SIMD instruction set;" + SimdKernels::getSimdLevelName() + "\n");
         fileWriter_.writeStringToFile("Number of replications for each size of matrix;" + std::to_string(numberOfReplications) + "\n");
         fileWriter_.writeStringToFile("Minimum matrix size;" + std::to_string(minSizeOfMatrix) + ";Maximum matrix size;" + std::to_string(maxSizeOfMatrix) + "\n");
         fileWriter_.writeStringToFile("Zero probability;" + std::to_string(zeroProbability) + "\n");
+        fileWriter_.writeStringToFile("Bandwidth;" + (bandwidth < 0 ? std::string("Full") : std::to_string(bandwidth)) + "\n");
         fileWriter_.writeStringToFile("Minimum possible generated value;" + std::to_string(minValue) + ";Maximum possible generated value;" + std::to_string(maxValue) + "\n");
         switch (dataType) {
             case 1: fileWriter_.writeStringToFile("Data type of generated values;Double\n"); break;
@@ -94,14 +149,22 @@ private:
 
         if (dataType == 1) {
             Generator<double> generator(minValue, maxValue, zeroProbability, seed);
+            generator.setBandwidth(bandwidth);
             performReplications<double, double>(method, generator, numberOfReplications, minSizeOfMatrix, maxSizeOfMatrix, multiplesOfMatrixSize);
 
         } else if (dataType == 2) {
             Generator<float> generator(minValue, maxValue, zeroProbability, seed);
+            generator.setBandwidth(bandwidth);
             performReplications<float, float>(method, generator, numberOfReplications, minSizeOfMatrix, maxSizeOfMatrix, multiplesOfMatrixSize);
         } else {
             Generator<int> generator(minValue, maxValue, zeroProbability, seed);
-            performReplications<double, int>(method, generator, numberOfReplications, minSizeOfMatrix, maxSizeOfMatrix, multiplesOfMatrixSize);
+            generator.setBandwidth(bandwidth);
+            // presné metódy (a automatický výber) počítajú s celými číslami, ostatné metódy počítajú v type double
+            if (isExactMethod(method) || method == AUTO_METHOD) {
+                performReplications<int, int>(method, generator, numberOfReplications, minSizeOfMatrix, maxSizeOfMatrix, multiplesOfMatrixSize);
+            } else {
+                performReplications<double, int>(method, generator, numberOfReplications, minSizeOfMatrix, maxSizeOfMatrix, multiplesOfMatrixSize);
+            }
         }
     }
 
@@ -129,28 +192,46 @@ private:
         double halfWidth;
         double lowerLimit;
         double upperLimit;
+        std::size_t peakScratchBytes;
         std::vector<double> matrixSizes;
         std::vector<double> averageTimes;
         std::vector<double> lowerLimits;
         std::vector<double> upperLimits;
+        std::vector<std::size_t> peakScratchSizes;
+        std::vector<int> selectedMethods;
+        std::vector<int> structurallySingularCounts;
+        std::vector<int> blockCounts;
+        std::vector<matrixStructure> structures;
+        MatrixPool<T> matrixPool;       // matice sa medzi replikáciami recyklujú, generátor prepíše všetky prvky
 
         while (matrixSize < maxSizeOfMatrix + 1) {
             sumTime = 0;
             sumTimeSquared = 0;
+            peakScratchBytes = 0;
+            int structurallySingularBefore = structurallySingularCount_;
+            // riedka a pásová matica sa vytvoria raz pre stupeň a v replikáciách sa prepisujú (pamäť ostane vyhradená)
+            SparseMatrix<T> sparse(method == SPARSE_LU_METHOD ? matrixSize : 0);
+            BandMatrix<T> band(method == BAND_LU_METHOD ? matrixSize : 0, generator.getBandwidth(), generator.getBandwidth());
             for (int i = 0; i < numberOfReplications; ++i) {
-                Matrix<T> matrix(matrixSize);
-                matrix.generateValues(generator);
-                switch (method) {
-                    case 1: time = algorithms_.gaussEliminationMethod(matrix, false); break;
-                    case 2: time = algorithms_.leibnizMethod(matrix, false); break;
-                    case 3: time = algorithms_.laplaceMethod(matrix, laplaceVariant::FULL_LAPLACE_EXPANSION, false); break;
-                    case 4: time = algorithms_.laplaceMethod(matrix, laplaceVariant::LAPLACE_RULE_OF_SARRUS, false); break;
-                    case 5: time = algorithms_.luDecomposition(matrix, false); break;
-                    default: time = algorithms_.gaussEliminationMethod(matrix, false); break;
+                if (method == SPARSE_LU_METHOD) {
+                    // riedka matica sa generuje priamo vo formáte CSR (rovnaká postupnosť prvkov ako hustá matica)
+                    sparse.generateValues(generator);
+                    time = computeSparseDeterminant(sparse, false);
+                } else if (method == BAND_LU_METHOD) {
+                    // pásová matica sa generuje priamo v pásovom tvare so šírkou pásma generátora
+                    band.generateValues(generator);
+                    time = algorithms_.bandLuMethod(band, false);
+                } else {
+                    Matrix<T> matrix = matrixPool.acquire(matrixSize);
+                    matrix.generateValues(generator);
+                    time = computeDeterminant(method, matrix, false);
+                    matrixPool.release(std::move(matrix));
                 }
+                peakScratchBytes = std::max(peakScratchBytes, algorithms_.getPeakScratchBytes());
                 sumTimeSquared += std::pow(time, 2);
                 sumTime += time;
             }
+            matrixPool.clear();     // matice tohto stupňa sa už nepoužijú
             avgTime = sumTime / numberOfReplications;
             standardDeviation = std::sqrt((sumTimeSquared - (std::pow(sumTime, 2) / numberOfReplications)) / (numberOfReplications - 1));
             halfWidth = (standardDeviation * 1.96) / std::sqrt(numberOfReplications);
@@ -161,6 +242,11 @@ private:
             averageTimes.push_back(avgTime);
             lowerLimits.push_back(lowerLimit);
             upperLimits.push_back(upperLimit);
+            peakScratchSizes.push_back(peakScratchBytes);
+            selectedMethods.push_back(lastSelectedMethod_);
+            structurallySingularCounts.push_back(structurallySingularCount_ - structurallySingularBefore);
+            blockCounts.push_back(lastBlockCount_);
+            structures.push_back(lastStructure_);
 
             matrixSize += multiplesOfMatrixSize;
         }
@@ -184,20 +270,248 @@ private:
             fileWriter_.writeDoubleToFile(upperLimits[i]);
             fileWriter_.writeStringToFile(";");
         }
+        fileWriter_.writeStringToFile("\nPeak scratch memory [B];");
+        for (std::size_t i = 0; i < peakScratchSizes.size(); ++i) {
+            fileWriter_.writeStringToFile(std::to_string(peakScratchSizes[i]));
+            fileWriter_.writeStringToFile(";");
+        }
+        if (structuralCheck_ || blockTriangular_) {
+            fileWriter_.writeStringToFile("\nStructurally singular replications;");
+            for (std::size_t i = 0; i < structurallySingularCounts.size(); ++i) {
+                fileWriter_.writeStringToFile(std::to_string(structurallySingularCounts[i]));
+                fileWriter_.writeStringToFile(";");
+            }
+        }
+        if (blockTriangular_) {
+            // počet diagonálnych blokov poslednej replikácie daného stupňa
+            fileWriter_.writeStringToFile("\nDiagonal blocks;");
+            for (std::size_t i = 0; i < blockCounts.size(); ++i) {
+                fileWriter_.writeStringToFile(std::to_string(blockCounts[i]));
+                fileWriter_.writeStringToFile(";");
+            }
+        }
+        if (structureDetection_) {
+            // rozloženie nenulových prvkov poslednej replikácie daného stupňa
+            fileWriter_.writeStringToFile("\nDetected structure;");
+            for (std::size_t i = 0; i < structures.size(); ++i) {
+                fileWriter_.writeStringToFile(getStructureName(structures[i]));
+                fileWriter_.writeStringToFile(";");
+            }
+        }
+        if (method == AUTO_METHOD) {
+            // metóda zvolená pre poslednú replikáciu daného stupňa
+            fileWriter_.writeStringToFile("\nSelected method;");
+            for (std::size_t i = 0; i < selectedMethods.size(); ++i) {
+                fileWriter_.writeStringToFile(getMethodName(selectedMethods[i]));
+                fileWriter_.writeStringToFile(";");
+            }
+        }
         fileWriter_.writeStringToFile("\n\n");
         fileWriter_.closeFile();
     }
 
+    /**
+     * Metóda specifyBatchExperiment slúži na nastavenie experimentu s dávkovým výpočtom determinantov veľkého počtu malých matíc.
+     *
+     * @param seed seed pre generátory
+     */
+    void specifyBatchExperiment(unsigned int seed) {
+        int batchMethod = readBatchMethodInput();
+        std::string methodSettings = configureBatchMethod(batchMethod);
+        int maxSize = batchMethod == BATCH_LU_METHOD ? 64 : 8;
+        int sizeOfMatrix = readIntInput("Enter the size of the matrices in the batch [1-" + std::to_string(maxSize) + "].", 1, maxSize);
+        int batchSize = readIntInput("Enter the number of matrices in the batch [1-10000000].", 1, 10000000);
+        int numberOfReplications = readIntInput("Enter the number of the replications [2-10000].", 2, 10000);
+        int seedSet = readIntInput("Do you want to set the seed? ['0' - no, '1' - yes].", 0, 1);
+        if (seedSet == 1) {
+            seed = readUnsignedIntInput("Enter the seed for the generator.", 0, std::numeric_limits<unsigned int>::max());
+        }
+        double zeroProbability = readDoubleInput("Enter the probability of zero elements in the matrix [0.0-1.0].", 0.0, 1.0);
+        int dataType = readIntInput("Choose the data type for generated elements [ '1' - double, '2' - float ].", 1, 2);
+        double minValue = readDoubleInput("Enter the minimum double for the generator.", std::numeric_limits<double>::lowest(), std::numeric_limits<double>::max());
+        double maxValue = readDoubleInput("Enter the maximum double for the generator.", std::numeric_limits<double>::lowest(), std::numeric_limits<double>::max());
+
+        std::string fileName = readFileNameInput("Enter the name of the file in the .csv format to save the results:", ".csv");
+        fileWriter_.setOutputFile(fileName);
+        fileWriter_.writeStringToFile(getBatchMethodName(batchMethod) + "\n");
+        fileWriter_.writeStringToFile(methodSettings);
+        fileWriter_.writeStringToFile("Seed;" + std::to_string(seed) + "\n");
+        fileWriter_.writeStringToFile("SIMD instruction set;" + SimdKernels::getSimdLevelName() + "\n");
+        fileWriter_.writeStringToFile("Number of replications;" + std::to_string(numberOfReplications) + "\n");
+        fileWriter_.writeStringToFile("Matrix size;" + std::to_string(sizeOfMatrix) + ";Number of matrices in the batch;" + std::to_string(batchSize) + "\n");
+        fileWriter_.writeStringToFile("Zero probability;" + std::to_string(zeroProbability) + "\n");
+        fileWriter_.writeStringToFile("Minimum possible generated value;" + std::to_string(minValue) + ";Maximum possible generated value;" + std::to_string(maxValue) + "\n");
+        if (dataType == 1) {
+            fileWriter_.writeStringToFile("Data type of generated values;Double\n");
+            Generator<double> generator(minValue, maxValue, zeroProbability, seed);
+            performBatchReplications<double>(batchMethod, generator, numberOfReplications, sizeOfMatrix, batchSize);
+        } else {
+            fileWriter_.writeStringToFile("Data type of generated values;Float\n");
+            Generator<float> generator(minValue, maxValue, zeroProbability, seed);
+            performBatchReplications<float>(batchMethod, generator, numberOfReplications, sizeOfMatrix, batchSize);
+        }
+    }
+
+    /**
+     * Metóda performBatchReplications slúži na vykonávanie replikácii dávkového výpočtu determinantov.
+     * Dávka sa vygeneruje raz (po zložkách) a v každej replikácii sa vypočítajú determinanty všetkých jej matíc.
+     *
+     * @tparam T dátový typ prvkov matíc
+     * @param batchMethod dávková výpočtová metóda
+     * @param generator generátor
+     * @param numberOfReplications počet replikácii
+     * @param sizeOfMatrix stupeň matíc
+     * @param batchSize počet matíc v dávke
+     */
+    template<typename T>
+    void performBatchReplications(int batchMethod, Generator<T>& generator, int numberOfReplications, int sizeOfMatrix, int batchSize) {
+        std::vector<T> elements(static_cast<std::size_t>(sizeOfMatrix) * sizeOfMatrix * batchSize);
+        std::vector<T> determinants(batchSize);
+        for (T& element : elements) {
+            element = generator.generate();
+        }
+
+        double sumTime = 0;
+        double sumTimeSquared = 0;
+        for (int i = 0; i < numberOfReplications; ++i) {
+            double time = computeBatchDeterminants(batchMethod, elements.data(), determinants.data(), batchSize, sizeOfMatrix, false);
+            sumTimeSquared += std::pow(time, 2);
+            sumTime += time;
+        }
+        double avgTime = sumTime / numberOfReplications;
+        double standardDeviation = std::sqrt((sumTimeSquared - (std::pow(sumTime, 2) / numberOfReplications)) / (numberOfReplications - 1));
+        double halfWidth = (standardDeviation * 1.96) / std::sqrt(numberOfReplications);
+
+        fileWriter_.writeStringToFile("Average time;");
+        fileWriter_.writeDoubleToFile(avgTime);
+        fileWriter_.writeStringToFile("\n95% Confidence interval (lower limit);");
+        fileWriter_.writeDoubleToFile(avgTime - halfWidth);
+        fileWriter_.writeStringToFile("\n95% Confidence interval (upper limit);");
+        fileWriter_.writeDoubleToFile(avgTime + halfWidth);
+        fileWriter_.writeStringToFile("\nDeterminants per second;");
+        fileWriter_.writeDoubleToFile(batchSize / avgTime);
+        fileWriter_.writeStringToFile("\n\n");
+        fileWriter_.closeFile();
+        std::cout << "Throughput of the " << getBatchMethodName(batchMethod) << ": " << batchSize / avgTime << " determinants per second" << std::endl;
+    }
+
+    /**
+     * Metóda calculateBatchFromFile slúži na načítanie dávky matíc zo súboru s viacerými maticami a na výpočet ich determinantov.
+     * Súbor má rovnakú hlavičku ako súbor s jednou maticou (stupeň a dátový typ), za ňou nasledujú prvky matíc po riadkoch.
+     */
+    void calculateBatchFromFile() {
+        std::string dataType;
+        int size;
+        int batchMethod = readBatchMethodInput();
+        configureBatchMethod(batchMethod);
+        std::string fileName = readFileNameInput("Enter the name of the file in the .txt format to load the matrices:", ".txt");
+        fileReader_.setInputFile(fileName);
+        fileReader_.readInitializationInfo(size, dataType);
+        if (batchMethod == BATCH_CLOSED_FORM_METHOD && (size < 1 || size > 8)) {
+            std::cerr << "The closed-form kernels support matrices of size 1 to 8." << std::endl;
+            return;
+        }
+
+        std::cout << std::endl;
+        if (dataType == "float") {
+            batchCalculation<float>(size, batchMethod);
+        } else if (dataType == "double" || dataType == "int") {
+            batchCalculation<double>(size, batchMethod);        // celočíselné matice sa počítajú v type double
+        } else {
+            std::cerr << "Invalid data type of the matrix.";
+        }
+        std::cout << std::endl;
+    }
+
+    /**
+     * Metóda batchCalculation slúži na výpočet determinantov dávky matíc načítanej zo vstupného súboru.
+     *
+     * @tparam T dátový typ prvkov matíc
+     * @param size stupeň (veľkosť) matíc
+     * @param batchMethod dávková výpočtová metóda
+     */
+    template<typename T>
+    void batchCalculation(int size, int batchMethod) {
+        std::vector<T> elements;
+        std::size_t count = fileReader_.fillBatch(elements, size);
+        if (count == 0) {
+            std::cerr << "The file does not contain any matrix." << std::endl;
+            return;
+        }
+        std::vector<T> determinants(count);
+        computeBatchDeterminants(batchMethod, elements.data(), determinants.data(), count, size, true);
+        for (std::size_t m = 0; m < count; ++m) {
+            std::cout << "The determinant of the matrix " << m + 1 << " is equal to: " << determinants[m] << std::endl;
+        }
+    }
+
+    /**
+     * Metóda computeBatchDeterminants slúži na výpočet determinantov dávky matíc zvolenou dávkovou metódou.
+     *
+     * @tparam T dátový typ prvkov matíc
+     * @param batchMethod dávková výpočtová metóda
+     * @param elements prvky matíc po zložkách
+     * @param determinants výstupné pole determinantov
+     * @param count počet matíc
+     * @param size stupeň matíc
+     * @param characterOutput či sa majú vypísať výsledky do konzoly (boolean)
+     * @return čas trvania výpočtu
+     */
+    template<typename T>
+    double computeBatchDeterminants(int batchMethod, const T* elements, T* determinants, std::size_t count, int size, bool characterOutput) {
+        if (batchMethod == BATCH_LU_METHOD) {
+            return algorithms_.batchLuMethod(elements, determinants, count, size, characterOutput);
+        }
+        return algorithms_.batchDeterminantMethod(elements, determinants, count, size, characterOutput);
+    }
+
+    /**
+     * Metóda readBatchMethodInput slúži na výber dávkovej výpočtovej metódy používateľom.
+     *
+     * @return zvolená dávková metóda
+     */
+    static int readBatchMethodInput() {
+        return readIntInput("Choose the batched method [ '" + std::to_string(BATCH_CLOSED_FORM_METHOD) + "' - " + getBatchMethodName(BATCH_CLOSED_FORM_METHOD)
+                            + ", '" + std::to_string(BATCH_LU_METHOD) + "' - " + getBatchMethodName(BATCH_LU_METHOD) + " ].", BATCH_CLOSED_FORM_METHOD, BATCH_LU_METHOD);
+    }
+
+    /**
+     * Metóda getBatchMethodName vráti názov dávkovej výpočtovej metódy.
+     *
+     * @param batchMethod dávková výpočtová metóda
+     * @return názov metódy
+     */
+    static std::string getBatchMethodName(int batchMethod) {
+        return batchMethod == BATCH_LU_METHOD ? "Interleaved Batched LU Decomposition" : "Batched Closed-Form Determinant";
+    }
+
+    /**
+     * Metóda configureBatchMethod slúži na načítanie nastavení dávkovej výpočtovej metódy.
+     *
+     * @param batchMethod dávková výpočtová metóda
+     * @return nastavenia metódy vo formáte riadkov .csv súboru (prázdny reťazec, ak metóda nemá nastavenia)
+     */
+    std::string configureBatchMethod(int batchMethod) {
+        std::string settings;
+        if (batchMethod == BATCH_LU_METHOD) {
+            int threadCount = readIntInput("Enter the number of threads [1-1024] (hardware threads: " + std::to_string(Algorithms::getDefaultThreadCount()) + ").", 1, 1024);
+            algorithms_.setThreadCount(threadCount);
+            settings += "Number of threads;" + std::to_string(threadCount) + "\n";
+        }
+        return settings;
+    }
+
     /**
      * Metóda calculateMatrixFromFile slúži na načítanie matice zo súboru a na výber výpočtovej metódy.
      */
     void calculateMatrixFromFile() {
         std::string dataType;
         int size;
-        int method = readIntInput("Choose the method for calculating the determinant [ '1' - Gauss Elimination, '2' - Leibniz Method, '3' - Full Laplace Expansion, '4' - Laplace Expansion + Rule of Sarrus, '5' - LU Decomposition, '6' - Exit ].", 1, 6);
-        if (method == 6) {
+        int method = readMethodInput("Choose the method for calculating the determinant");
+        if (method > NUMBER_OF_METHODS) {
             return;
         }
+        configureMethod(method);
         std::string fileName = readFileNameInput("Enter the name of the file in the .txt format to load the matrix:", ".txt");
         fileReader_.setInputFile(fileName);
         fileReader_.readInitializationInfo(size, dataType);
@@ -207,6 +521,8 @@ private:
             calculation<float>(size, method);
         } else if (dataType == "double") {
             calculation<double>(size, method);
+        } else if (dataType == "int") {
+            calculation<int>(size, method);
         } else {
             std::cerr << "Invalid data type of the matrix.";
         }
@@ -223,17 +539,568 @@ private:
      */
     template<typename T>
     void calculation(int size, int method) {
+        if (method == SPARSE_LU_METHOD) {
+            // celočíselná matica sa pre riedky LU rozklad načíta v type double
+            SparseMatrix<std::conditional_t<std::is_integral_v<T>, double, T>> sparse(size);
+            fileReader_.fillSparseMatrix(sparse);
+            std::cout << "Density of the sparse matrix: " << sparse.getDensity() << std::endl;
+            computeSparseDeterminant(sparse, true);
+            return;
+        }
+        if (method == BAND_LU_METHOD) {
+            // matica sa načíta ako riedka a pred pásovým LU rozkladom sa preusporiada
+            SparseMatrix<std::conditional_t<std::is_integral_v<T>, double, T>> sparse(size);
+            fileReader_.fillSparseMatrix(sparse);
+            algorithms_.bandLuMethod(sparse, true);
+            return;
+        }
         Matrix<T> matrix(size);
         fileReader_.fillMatrix(matrix);
 
+        computeDeterminant(method, matrix, true);
+    }
+
+    /**
+     * Metóda computeDeterminant slúži na výpočet determinantu štvorcovej matice zvolenou výpočtovou metódou.
+     * Ak je zapnuté rozpoznávanie štruktúry, diagonálna, trojuholníková, trojdiagonálna a Hessenbergova matica
+     * sa namiesto zvolenej metódy počíta vlastnou rekurenciou (vrátený čas zahŕňa aj rozpoznanie).
+     *
+     * @tparam T dátový typ prvkov matice
+     * @param method výpočtová metóda
+     * @param matrix referencia na maticu
+     * @param characterOutput či sa majú vypísať výsledky do konzoly (boolean)
+     * @return čas trvania výpočtu
+     */
+    template<typename T>
+    double computeDeterminant(int method, Matrix<T>& matrix, bool characterOutput) {
+        if (!structureDetection_) {
+            return computeGeneralDeterminant(method, matrix, characterOutput);
+        }
+        auto start = std::chrono::system_clock::now();
+        lastStructure_ = Algorithms::detectStructure(matrix);
+        std::chrono::duration<double> detectionTime = std::chrono::system_clock::now() - start;
+        if (lastStructure_ == GENERAL_MATRIX) {
+            return detectionTime.count() + computeGeneralDeterminant(method, matrix, characterOutput);
+        }
+        if (characterOutput) {
+            std::cout << "Detected structure of the matrix: " << getStructureName(lastStructure_) << std::endl;
+        }
+        return detectionTime.count() + algorithms_.structuredMethod(matrix, lastStructure_, characterOutput);
+    }
+
+    /**
+     * Metóda computeGeneralDeterminant slúži na výpočet determinantu štvorcovej matice zvolenou výpočtovou metódou.
+     * Ak je zapnutá kontrola štrukturálnej singularity alebo rozklad na bloky, matica bez perfektného párovania
+     * nenulových prvkov sa nepočíta (determinant je 0) a vrátený čas je iba čas kontroly.
+     *
+     * @tparam T dátový typ prvkov matice
+     * @param method výpočtová metóda
+     * @param matrix referencia na maticu
+     * @param characterOutput či sa majú vypísať výsledky do konzoly (boolean)
+     * @return čas trvania výpočtu
+     */
+    template<typename T>
+    double computeGeneralDeterminant(int method, Matrix<T>& matrix, bool characterOutput) {
+        if (!structuralCheck_ && !blockTriangular_) {
+            return dispatchDeterminant(algorithms_, method, matrix, characterOutput);
+        }
+        auto start = std::chrono::system_clock::now();
+        StructuralAnalysis analysis(matrix);
+        if (reportStructuralSingularity(analysis, matrix.getSize(), characterOutput, start)) {
+            lastBlockCount_ = 0;
+            algorithms_.setPeakScratchBytes(0);     // determinant sa nepočítal
+            std::chrono::duration<double> checkTime = std::chrono::system_clock::now() - start;
+            return checkTime.count();
+        }
+        if (blockTriangular_) {
+            return computeByBlocks(method, matrix, analysis, characterOutput, start);
+        }
+        std::chrono::duration<double> checkTime = std::chrono::system_clock::now() - start;
+        return checkTime.count() + dispatchDeterminant(algorithms_, method, matrix, characterOutput);
+    }
+
+    /**
+     * Metóda computeSparseDeterminant slúži na výpočet determinantu riedkej matice riedkym LU rozkladom
+     * (s rovnakou kontrolou štrukturálnej singularity ako computeDeterminant).
+     *
+     * @tparam T dátový typ prvkov matice
+     * @param matrix referencia na riedku maticu
+     * @param characterOutput či sa majú vypísať výsledky do konzoly (boolean)
+     * @return čas trvania výpočtu
+     */
+    template<typename T>
+    double computeSparseDeterminant(SparseMatrix<T>& matrix, bool characterOutput) {
+        if (!structuralCheck_) {
+            return algorithms_.sparseLuMethod(matrix, characterOutput);
+        }
+        auto start = std::chrono::system_clock::now();
+        StructuralAnalysis analysis(matrix);
+        if (reportStructuralSingularity(analysis, matrix.getSize(), characterOutput, start)) {
+            algorithms_.setPeakScratchBytes(0);     // determinant sa nepočítal
+            std::chrono::duration<double> checkTime = std::chrono::system_clock::now() - start;
+            return checkTime.count();
+        }
+        std::chrono::duration<double> checkTime = std::chrono::system_clock::now() - start;
+        return checkTime.count() + algorithms_.sparseLuMethod(matrix, characterOutput);
+    }
+
+    /**
+     * Metóda reportStructuralSingularity zistí maximálnym párovaním riadkov a stĺpcov (Hopcroftov-Karpov algoritmus),
+     * či je matica štrukturálne singulárna, a takú maticu započíta.
+     *
+     * @param analysis štruktúra nenulových prvkov matice
+     * @param size stupeň matice
+     * @param characterOutput či sa má výsledok vypísať do konzoly (boolean)
+     * @param start začiatok kontroly
+     * @return či je matica štrukturálne singulárna (boolean)
+     */
+    bool reportStructuralSingularity(StructuralAnalysis& analysis, int size, bool characterOutput, std::chrono::system_clock::time_point start) {
+        if (!analysis.isStructurallySingular()) {
+            return false;
+        }
+        structurallySingularCount_++;
+        if (characterOutput) {
+            std::chrono::duration<double> elapsedTime = std::chrono::system_clock::now() - start;
+            std::cout << "The matrix is structurally singular (structural rank " << analysis.getMatchingSize() << " of " << size << ")." << std::endl;
+            std::cout << "The determinant of the matrix is equal to: 0" << std::endl;
+            std::cout << "Calculation duration of the structural check: " << elapsedTime << std::endl;
+        }
+        return true;
+    }
+
+    /**
+     * Metóda computeByBlocks vypočíta determinant matice s perfektným párovaním ako súčin determinantov diagonálnych blokov
+     * jej blokového trojuholníkového tvaru. Bloky stupňa 1 sú priamo prvkami matice, ostatné bloky počíta zvolená metóda
+     * (automatický výber vyberá metódu pre každý blok zvlášť). Viac blokov sa počíta paralelne, každé vlákno má vlastnú
+     * inštanciu algoritmov s jedným vláknom, jediný blok sa počíta hlavnou inštanciou so všetkými vláknami.
+     * Vrátený čas zahŕňa aj párovanie a hľadanie blokov (od začiatku kontroly).
+     *
+     * @tparam T dátový typ prvkov matice
+     * @param method výpočtová metóda
+     * @param matrix referencia na maticu
+     * @param analysis štruktúra nenulových prvkov matice (s perfektným párovaním)
+     * @param characterOutput či sa majú vypísať výsledky do konzoly (boolean)
+     * @param start začiatok kontroly
+     * @return čas trvania výpočtu
+     */
+    template<typename T>
+    double computeByBlocks(int method, Matrix<T>& matrix, StructuralAnalysis& analysis, bool characterOutput, std::chrono::system_clock::time_point start) {
+        std::vector<int> rowOrder;
+        std::vector<int> columnOrder;
+        std::vector<int> blockStarts;
+        int sign = analysis.getBlockTriangularForm(rowOrder, columnOrder, blockStarts);
+        int blockCount = static_cast<int>(blockStarts.size()) - 1;
+        int largestBlock = 0;
+        for (int block = 0; block < blockCount; ++block) {
+            largestBlock = std::max(largestBlock, blockStarts[block + 1] - blockStarts[block]);
+        }
+        lastBlockCount_ = blockCount;
+        if (characterOutput) {
+            std::cout << "Block triangular form: " << blockCount << " diagonal blocks (largest block: " << largestBlock << ")" << std::endl;
+        }
+        if (blockCount == 1) {
+            // nerozložiteľná matica sa počíta bez permutácie
+            std::chrono::duration<double> checkTime = std::chrono::system_clock::now() - start;
+            return checkTime.count() + dispatchDeterminant(algorithms_, method, matrix, characterOutput);
+        }
+
+        // bloky väčšie ako 1 zoradené zostupne podľa stupňa (najdlhšie výpočty sa začnú prvé)
+        std::vector<int> pending;
+        std::vector<blockResult> results(blockCount);
+        for (int block = 0; block < blockCount; ++block) {
+            int position = blockStarts[block];
+            if (blockStarts[block + 1] - position == 1) {
+                T value = matrix[rowOrder[position]][columnOrder[position]];
+                results[block] = {static_cast<double>(value), std::is_integral_v<T> ? BigInteger(static_cast<long long>(value)) : BigInteger(), std::is_integral_v<T>};
+            } else {
+                pending.push_back(block);
+            }
+        }
+        std::sort(pending.begin(), pending.end(), [&](int first, int second) {
+            return blockStarts[first + 1] - blockStarts[first] > blockStarts[second + 1] - blockStarts[second];
+        });
+
+        // metódy blokov sa pri automatickom výbere zvolia vopred (výber mení stav aplikácie)
+        std::vector<int> blockMethods(blockCount, method);
+        std::vector<int> hybridCutoffs(blockCount, 0);
+        std::vector<Matrix<T>> blocks;
+        blocks.reserve(pending.size());
+        for (int block : pending) {
+            int position = blockStarts[block];
+            int blockSize = blockStarts[block + 1] - position;
+            blocks.emplace_back(blockSize, false);
+            for (int i = 0; i < blockSize; ++i) {
+                const T* row = matrix[rowOrder[position + i]];
+                for (int j = 0; j < blockSize; ++j) {
+                    blocks.back()[i][j] = row[columnOrder[position + j]];
+                }
+            }
+            if (method == AUTO_METHOD) {
+                blockMethods[block] = selectMethod(blocks.back(), false, hybridCutoffs[block]);
+            }
+        }
+        if (method == AUTO_METHOD && !pending.empty()) {
+            lastSelectedMethod_ = blockMethods[pending.front()];    // metóda najväčšieho bloku
+        }
+
+        auto computeBlock = [&](Algorithms& algorithms, int index) {
+            int block = pending[index];
+            int configuredCutoff = algorithms.getHybridCutoff();
+            if (blockMethods[block] == HYBRID_LAPLACE_METHOD && hybridCutoffs[block] > 0) {
+                algorithms.setHybridCutoff(hybridCutoffs[block]);
+            }
+            dispatchDeterminant(algorithms, blockMethods[block], blocks[index], false);
+            algorithms.setHybridCutoff(configuredCutoff);    // odhad pre blok neprepíše nastavenie používateľa
+            results[block] = {algorithms.getLastDeterminant(), algorithms.getLastExactDeterminant(), algorithms.isLastResultExact()};
+        };
+        if (pending.size() == 1) {
+            computeBlock(algorithms_, 0);
+        } else if (!pending.empty()) {
+            int threadCount = std::min(algorithms_.getThreadCount(), static_cast<int>(pending.size()));
+            if (!blockPool_ || blockPool_->getThreadCount() != threadCount) {
+                blockPool_ = std::make_unique<ThreadPool>(threadCount);
+            }
+            blockAlgorithms_.resize(threadCount);
+            for (Algorithms& algorithms : blockAlgorithms_) {
+                algorithms.copySettings(algorithms_);
+                algorithms.setThreadCount(1);
+            }
+            std::vector<std::size_t> threadPeaks(threadCount, 0);      // maximum pomocnej pamäte blokov každého vlákna
+            blockPool_->parallelForDynamic(static_cast<int>(pending.size()), [&](int index, int thread) {
+                computeBlock(blockAlgorithms_[thread], index);
+                threadPeaks[thread] = std::max(threadPeaks[thread], blockAlgorithms_[thread].getPeakScratchBytes());
+            });
+            // hlavná inštancia nepočítala, maximum pomocnej pamäte je najväčšie maximum vlákien
+            algorithms_.setPeakScratchBytes(*std::max_element(threadPeaks.begin(), threadPeaks.end()));
+        } else {
+            algorithms_.setPeakScratchBytes(0);     // všetky bloky majú stupeň 1
+        }
+
+        bool exact = true;
+        double determinant = sign;
+        BigInteger exactDeterminant(sign);
+        for (const blockResult& result : results) {
+            determinant *= result.value;
+            exact = exact && result.exact;
+            if (exact) {
+                exactDeterminant *= result.exactValue;
+            }
+        }
+        std::chrono::duration<double> elapsedTime = std::chrono::system_clock::now() - start;
+        if (characterOutput) {
+            if (exact) {
+                std::cout << "The determinant of the matrix is equal to: " << exactDeterminant << std::endl;
+            } else {
+                std::cout << "The determinant of the matrix is equal to: " << determinant << std::endl;
+            }
+            std::cout << "Calculation duration of the " << getMethodName(method) << " by diagonal blocks: " << elapsedTime << std::endl;
+        }
+        return elapsedTime.count();
+    }
+
+    /**
+     * Metóda dispatchDeterminant vypočíta determinant štvorcovej matice zvolenou výpočtovou metódou (bez kontroly štruktúry).
+     *
+     * @tparam T dátový typ prvkov matice
+     * @param algorithms inštancia algoritmov, ktorá determinant vypočíta
+     * @param method výpočtová metóda
+     * @param matrix referencia na maticu
+     * @param characterOutput či sa majú vypísať výsledky do konzoly (boolean)
+     * @return čas trvania výpočtu
+     */
+    template<typename T>
+    double dispatchDeterminant(Algorithms& algorithms, int method, Matrix<T>& matrix, bool characterOutput) {
+        if (method == AUTO_METHOD) {
+            return computeAutomatically(algorithms, matrix, characterOutput);
+        }
+        // celočíselnú maticu počítajú presne iba presné metódy, pre ostatné metódy sa prevedie na typ double
+        if constexpr (std::is_integral_v<T>) {
+            if (!isExactMethod(method)) {
+                Matrix<double> converted(matrix.getSize(), false);
+                for (int i = 0; i < matrix.getSize(); ++i) {
+                    std::copy(matrix[i], matrix[i] + matrix.getSize(), converted[i]);
+                }
+                return dispatchDeterminant(algorithms, method, converted, characterOutput);
+            }
+        }
         switch (method) {
-            case 1: algorithms_.gaussEliminationMethod(matrix, true); break;
-            case 2: algorithms_.leibnizMethod(matrix, true); break;
-            case 3: algorithms_.laplaceMethod(matrix, laplaceVariant::FULL_LAPLACE_EXPANSION, true); break;
-            case 4: algorithms_.laplaceMethod(matrix, laplaceVariant::LAPLACE_RULE_OF_SARRUS, true); break;
-            case 5: algorithms_.luDecomposition(matrix, true); break;
-            default: algorithms_.gaussEliminationMethod(matrix, true); break;
+            case 1: return algorithms.gaussEliminationMethod(matrix, characterOutput);
+            case 2: return algorithms.leibnizMethod(matrix, characterOutput);
+            case 3: return algorithms.laplaceMethod(matrix, laplaceVariant::FULL_LAPLACE_EXPANSION, characterOutput);
+            case 4: return algorithms.laplaceMethod(matrix, laplaceVariant::LAPLACE_RULE_OF_SARRUS, characterOutput);
+            case 5: return algorithms.luDecomposition(matrix, characterOutput);
+            case 6: return algorithms.blockedLuDecomposition(matrix, characterOutput);
+            case 7: return algorithms.parallelGaussEliminationMethod(matrix, characterOutput);
+            case 8: return algorithms.tiledLuDecomposition(matrix, characterOutput);
+            case 9: return algorithms.bareissMethod(matrix, characterOutput);
+            case 10: return algorithms.multiModularMethod(matrix, characterOutput);
+            case 11: return algorithms.parallelLeibnizMethod(matrix, characterOutput);
+            case 12: return algorithms.laplaceMethod(matrix, laplaceVariant::LAPLACE_SUBSET_DP, characterOutput);
+            case 13: return algorithms.parallelLaplaceMethod(matrix, parallelLaplaceVariant_, characterOutput);
+            case 14: return algorithms.hybridLaplaceMethod(matrix, characterOutput);
+            case 16: return algorithms.sparseLuMethod(matrix, characterOutput);
+            case 17: return algorithms.bandLuMethod(matrix, characterOutput);
+            default: return algorithms.gaussEliminationMethod(matrix, characterOutput);
+        }
+    }
+
+    /**
+     * Metóda computeAutomatically vyberie podľa modelu ceny metódu s najmenším odhadovaným časom a vypočíta ňou determinant.
+     * Vrátený čas zahŕňa aj čas výberu.
+     *
+     * @tparam T dátový typ prvkov matice
+     * @param algorithms inštancia algoritmov, ktorá determinant vypočíta
+     * @param matrix referencia na maticu
+     * @param characterOutput či sa majú vypísať výsledky do konzoly (boolean)
+     * @return čas trvania výberu a výpočtu
+     */
+    template<typename T>
+    double computeAutomatically(Algorithms& algorithms, Matrix<T>& matrix, bool characterOutput) {
+        auto start = std::chrono::system_clock::now();
+        int hybridCutoff;
+        int method = selectMethod(matrix, characterOutput, hybridCutoff);
+        int configuredCutoff = algorithms.getHybridCutoff();
+        if (method == HYBRID_LAPLACE_METHOD) {
+            algorithms.setHybridCutoff(hybridCutoff);
+        }
+        std::chrono::duration<double> selectionTime = std::chrono::system_clock::now() - start;
+        double time = selectionTime.count() + dispatchDeterminant(algorithms, method, matrix, characterOutput);
+        algorithms.setHybridCutoff(configuredCutoff);    // odhad modelu neprepíše nastavenie používateľa
+        return time;
+    }
+
+    /**
+     * Metóda selectMethod vyberie podľa modelu ceny metódu s najmenším odhadovaným časom pre stupeň matice,
+     * typ jej prvkov, nameraný podiel nulových prvkov a šírku pásma. Celočíselné matice s požiadavkou na presný výsledok
+     * počítajú iba presné metódy.
+     *
+     * @tparam T dátový typ prvkov matice
+     * @param matrix referencia na maticu
+     * @param characterOutput či sa má zvolená metóda vypísať do konzoly (boolean)
+     * @param hybridCutoff výstup: stupeň minoru pre hybridný Laplaceov rozvoj
+     * @return zvolená metóda
+     */
+    template<typename T>
+    int selectMethod(Matrix<T>& matrix, bool characterOutput, int& hybridCutoff) {
+        int size = matrix.getSize();
+        std::size_t zeros = 0;
+        int bandwidth = 0;      // najväčšia vzdialenosť nenulového prvku od hlavnej diagonály
+        for (int i = 0; i < size; ++i) {
+            for (int j = 0; j < size; ++j) {
+                if (matrix[i][j] == T(0)) {
+                    ++zeros;
+                } else {
+                    bandwidth = std::max(bandwidth, std::abs(i - j));
+                }
+            }
+        }
+        double zeroDensity = static_cast<double>(zeros) / (static_cast<double>(size) * size);
+        double estimatedTime;
+        int method = costModel_.select(size, zeroDensity, bandwidth, std::is_integral_v<T>, requireExact_, hybridCutoff, estimatedTime);
+        if (method == 0) {
+            std::cerr << "The cost model has no method for the matrix, the Gauss elimination is used instead." << std::endl;
+            method = 1;
+        }
+        lastSelectedMethod_ = method;
+        if (characterOutput) {
+            std::cout << "Automatically selected method: " << getMethodName(method) << " (zero density: " << zeroDensity
+                      << ", estimated time: " << estimatedTime << "s)" << std::endl;
+        }
+        return method;
+    }
+
+    /**
+     * Metóda registerCostCurves zaregistruje v modeli ceny metódy, spomedzi ktorých vyberá automatický výber.
+     */
+    void registerCostCurves() {
+        costModel_.addMethod(1, CUBIC_GROWTH, false);
+        costModel_.addMethod(2, FACTORIAL_GROWTH, false);
+        costModel_.addMethod(3, FACTORIAL_GROWTH, false);
+        costModel_.addMethod(4, FACTORIAL_GROWTH, false);
+        costModel_.addMethod(5, CUBIC_GROWTH, false);
+        costModel_.addMethod(6, CUBIC_GROWTH, false);
+        costModel_.addMethod(7, CUBIC_GROWTH, false);
+        costModel_.addMethod(8, CUBIC_GROWTH, false);
+        costModel_.addMethod(BAREISS_METHOD, CUBIC_GROWTH, true);
+        costModel_.addMethod(MULTI_MODULAR_METHOD, CUBIC_GROWTH, true);
+        costModel_.addMethod(11, FACTORIAL_GROWTH, false);
+        costModel_.addMethod(12, EXPONENTIAL_GROWTH, false);
+        costModel_.addMethod(13, FACTORIAL_GROWTH, false);
+        costModel_.addMethod(HYBRID_LAPLACE_METHOD, HYBRID_GROWTH, false);
+        costModel_.addMethod(BAND_LU_METHOD, BAND_GROWTH, false);
+    }
+
+    /**
+     * Metóda prepareCostModel načíta krivky modelu ceny zo súboru. Ak súbor chýba alebo vznikol v inom prostredí
+     * (iná inštrukčná sada alebo počet vlákien), metódy sa na tomto počítači zmerajú znovu a krivky sa uložia.
+     */
+    void prepareCostModel() {
+        std::string signature = "SIMD instruction set;" + SimdKernels::getSimdLevelName() + ";Number of threads;" + std::to_string(algorithms_.getThreadCount());
+        if (costModel_.load(signature)) {
+            return;
+        }
+        std::cout << "Calibrating the cost model on this machine..." << std::endl;
+        int configuredCutoff = algorithms_.getHybridCutoff();
+        Generator<double> doubleGenerator(-10, 10, 0, 1);
+        Generator<int> intGenerator(-10, 10, 0, 1);
+        costModel_.calibrate([this, &doubleGenerator, &intGenerator](int method, int size, bool exact) {
+            if (method == HYBRID_LAPLACE_METHOD) {
+                algorithms_.setHybridCutoff(CostModel::HYBRID_CALIBRATION_CUTOFF);
+            }
+            doubleGenerator.setBandwidth(method == BAND_LU_METHOD ? CostModel::BAND_CALIBRATION_BANDWIDTH : -1);
+            if (exact) {
+                Matrix<int> matrix(size, false);
+                matrix.generateValues(intGenerator);
+                return dispatchDeterminant(algorithms_, method, matrix, false);
+            }
+            Matrix<double> matrix(size, false);
+            matrix.generateValues(doubleGenerator);
+            return dispatchDeterminant(algorithms_, method, matrix, false);
+        });
+        algorithms_.setHybridCutoff(configuredCutoff);
+        costModel_.save(signature);
+        std::cout << "The cost model was saved to the file: " << costModel_.getFileName() << std::endl;
+    }
+
+    /**
+     * Metóda getMethodName vráti názov výpočtovej metódy.
+     *
+     * @param method výpočtová metóda
+     * @return názov metódy
+     */
+    static std::string getMethodName(int method) {
+        switch (method) {
+            case 1: return "Gauss Elimination";
+            case 2: return "Leibniz Method";
+            case 3: return "Full Laplace Expansion";
+            case 4: return "Laplace Expansion + Rule of Sarrus";
+            case 5: return "LU Decomposition";
+            case 6: return "Blocked LU Decomposition";
+            case 7: return "Parallel Gauss Elimination";
+            case 8: return "Tiled Task-DAG LU Decomposition";
+            case 9: return "Bareiss Algorithm";
+            case 10: return "Multi-Modular Method";
+            case 11: return "Parallel Leibniz Method";
+            case 12: return "Laplace Expansion with Subset DP";
+            case 13: return "Parallel Laplace Expansion (Work Stealing)";
+            case 14: return "Hybrid Laplace Expansion + LU Decomposition";
+            case 15: return "Automatic Selection";
+            case 16: return "Sparse LU Decomposition (Markowitz)";
+            case 17: return "Band LU Decomposition (Reverse Cuthill-McKee)";
+            default: return "Exit";
+        }
+    }
+
+    /**
+     * Metóda getStructureName vráti názov rozloženia nenulových prvkov matice.
+     *
+     * @param structure rozloženie nenulových prvkov matice
+     * @return názov rozloženia
+     */
+    static std::string getStructureName(matrixStructure structure) {
+        switch (structure) {
+            case DIAGONAL_MATRIX: return "Diagonal";
+            case UPPER_TRIANGULAR_MATRIX: return "Upper triangular";
+            case LOWER_TRIANGULAR_MATRIX: return "Lower triangular";
+            case TRIDIAGONAL_MATRIX: return "Tridiagonal";
+            case UPPER_HESSENBERG_MATRIX: return "Upper Hessenberg";
+            case LOWER_HESSENBERG_MATRIX: return "Lower Hessenberg";
+            default: return "General";
+        }
+    }
+
+    /**
+     * Metóda isExactMethod zistí, či metóda počíta determinant celočíselnej matice presne (v celých číslach).
+     *
+     * @param method výpočtová metóda
+     * @return či je metóda presná (boolean)
+     */
+    static bool isExactMethod(int method) {
+        return method == BAREISS_METHOD || method == MULTI_MODULAR_METHOD;
+    }
+
+    /**
+     * Metóda isParallelMethod zistí, či metóda počíta na viacerých vláknach (a pýta si ich počet).
+     *
+     * @param method výpočtová metóda
+     * @return či je metóda paralelná (boolean)
+     */
+    static bool isParallelMethod(int method) {
+        return method == 7 || method == 8 || method == MULTI_MODULAR_METHOD || method == 11 || method == 13 || method == AUTO_METHOD;
+    }
+
+    /**
+     * Metóda configureMethod slúži na načítanie nastavení špecifických pre zvolenú výpočtovú metódu.
+     *
+     * @param method výpočtová metóda
+     * @return nastavenia metódy vo formáte riadkov .csv súboru (prázdny reťazec, ak metóda nemá nastavenia)
+     */
+    std::string configureMethod(int method) {
+        std::string settings;
+        if (method == 6 || method == 8) {
+            int blockSize = readIntInput("Enter the block (tile) size for the " + getMethodName(method) + " [1-1024] (default " + std::to_string(Algorithms::DEFAULT_LU_BLOCK_SIZE) + ").", 1, 1024);
+            algorithms_.setLuBlockSize(blockSize);
+            settings += "Block size;" + std::to_string(blockSize) + "\n";
+        }
+        if (isParallelMethod(method)) {
+            int threadCount = readIntInput("Enter the number of threads [1-1024] (hardware threads: " + std::to_string(Algorithms::getDefaultThreadCount()) + ").", 1, 1024);
+            algorithms_.setThreadCount(threadCount);
+            settings += "Number of threads;" + std::to_string(threadCount) + "\n";
+        }
+        if (method == 7) {
+            int cutoff = readIntInput("Enter the submatrix size below which the computation continues serially [1-100000] (default " + std::to_string(Algorithms::DEFAULT_PARALLEL_CUTOFF) + ").", 1, 100000);
+            algorithms_.setParallelCutoff(cutoff);
+            settings += "Serial cutoff size;" + std::to_string(cutoff) + "\n";
+        }
+        if (method == 13) {
+            int variant = readIntInput("Choose the variant of the parallel Laplace expansion [ '1' - full expansion, '2' - expansion + Rule of Sarrus ].", 1, 2);
+            parallelLaplaceVariant_ = variant == 1 ? FULL_LAPLACE_EXPANSION : LAPLACE_RULE_OF_SARRUS;
+            settings += std::string("Laplace variant;") + (variant == 1 ? "Full expansion" : "Rule of Sarrus") + "\n";
+            int spawnDepth = readIntInput("Enter the expansion depth up to which tasks are spawned [0-16] (default " + std::to_string(Algorithms::DEFAULT_LAPLACE_SPAWN_DEPTH) + ").", 0, 16);
+            algorithms_.setLaplaceSpawnDepth(spawnDepth);
+            settings += "Spawn depth;" + std::to_string(spawnDepth) + "\n";
+        }
+        if (method == HYBRID_LAPLACE_METHOD) {
+            int cutoff = readIntInput("Enter the minor size from which the expansion continues with the LU decomposition [1-1000] (default " + std::to_string(Algorithms::DEFAULT_HYBRID_CUTOFF) + ").", 1, 1000);
+            algorithms_.setHybridCutoff(cutoff);
+            settings += "LU cutoff size;" + std::to_string(cutoff) + "\n";
+        }
+        if (method == AUTO_METHOD) {
+            requireExact_ = readIntInput("Do integer matrices require the exact result? ['0' - no, '1' - yes].", 0, 1) == 1;
+            settings += "Exact result for integer matrices;" + std::to_string(requireExact_) + "\n";
+            prepareCostModel();
+            settings += "Cost model;" + costModel_.getFileName() + "\n";
+        }
+        structuralCheck_ = false;
+        blockTriangular_ = false;
+        structureDetection_ = false;
+        if (method == BAND_LU_METHOD) {
+            // pásová matica sa počíta bez predspracovania štruktúry
+            return settings;
+        }
+        structuralCheck_ = readIntInput("Do you want to detect structurally singular matrices before the calculation (bipartite matching)? ['0' - no, '1' - yes].", 0, 1) == 1;
+        settings += "Structural singularity check;" + std::to_string(structuralCheck_) + "\n";
+        if (method != SPARSE_LU_METHOD) {
+            blockTriangular_ = readIntInput("Do you want to split the matrix into the diagonal blocks of its block triangular form (Dulmage-Mendelsohn decomposition)? ['0' - no, '1' - yes].", 0, 1) == 1;
+            settings += "Block triangular decomposition;" + std::to_string(blockTriangular_) + "\n";
+            structureDetection_ = readIntInput("Do you want to detect diagonal, triangular, tridiagonal and Hessenberg matrices before the calculation? ['0' - no, '1' - yes].", 0, 1) == 1;
+            settings += "Structure detection;" + std::to_string(structureDetection_) + "\n";
+        }
+        return settings;
+    }
+
+    /**
+     * Metóda readMethodInput slúži na výber výpočtovej metódy používateľom.
+     *
+     * @param prompt výzva na zadanie vstupu (bez zoznamu metód)
+     * @return zvolená metóda (NUMBER_OF_METHODS + 1 predstavuje Exit)
+     */
+    static int readMethodInput(const std::string& prompt) {
+        std::string menu = prompt + " [ ";
+        for (int method = 1; method <= NUMBER_OF_METHODS + 1; ++method) {
+            menu += "'" + std::to_string(method) + "' - " + getMethodName(method) + (method <= NUMBER_OF_METHODS ? ", " : " ].");
         }
+        return readIntInput(menu, 1, NUMBER_OF_METHODS + 1);
     }
 
     /**
@@ -0,0 +1,221 @@
+#ifndef BAKALARSKAPRACA_BANDMATRIX_H
+#define BAKALARSKAPRACA_BANDMATRIX_H
+
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+#include "Generator.h"
+#include "Matrix.h"
+#include "SparseMatrix.h"
+
+/**
+ * Trieda BandMatrix reprezentuje pásovú štvorcovú maticu, ktorej nenulové prvky ležia iba na hlavnej diagonále,
+ * na lowerBandwidth diagonálach pod ňou a upperBandwidth diagonálach nad ňou. Ukladajú sa iba tieto diagonály
+ * po riadkoch: riadok i obsahuje prvky stĺpcov i - lowerBandwidth až i + upperBandwidth (prvky mimo matice sú nulové),
+ * takže pamäť je úmerná n * (lowerBandwidth + upperBandwidth + 1) a nie štvorcu stupňa.
+ *
+ * @tparam T dátový typ prvkov matice
+ */
+template<class T>
+class BandMatrix {
+private:
+    int size_;                  // stupeň (veľkosť) štvorcovej matice
+    int lowerBandwidth_;        // počet diagonál pod hlavnou diagonálou
+    int upperBandwidth_;        // počet diagonál nad hlavnou diagonálou
+    int width_;                 // počet uložených prvkov riadku (lowerBandwidth + upperBandwidth + 1)
+    std::vector<T> values_;     // prvky pásma po riadkoch
+public:
+    /**
+     * Konštruktor pre nulovú pásovú maticu (šírky pásma sa obmedzia na size - 1).
+     *
+     * @param size stupeň (veľkosť) štvorcovej matice
+     * @param lowerBandwidth počet diagonál pod hlavnou diagonálou
+     * @param upperBandwidth počet diagonál nad hlavnou diagonálou
+     */
+    BandMatrix(int size, int lowerBandwidth, int upperBandwidth) : size_(size),
+            lowerBandwidth_(std::clamp(lowerBandwidth, 0, std::max(size - 1, 0))), upperBandwidth_(std::clamp(upperBandwidth, 0, std::max(size - 1, 0))),
+            width_(lowerBandwidth_ + upperBandwidth_ + 1), values_(static_cast<std::size_t>(size) * width_, T(0)) {};
+
+    /**
+     * Konštruktor, ktorý prevedie hustú maticu na pásovú s najmenším pásmom obsahujúcim všetky nenulové prvky.
+     *
+     * @param matrix referencia na hustú maticu
+     */
+    explicit BandMatrix(Matrix<T>& matrix) : BandMatrix(matrix.getSize(), measureLowerBandwidth(matrix), measureUpperBandwidth(matrix)) {
+        for (int i = 0; i < size_; ++i) {
+            for (int j = getFirstColumn(i); j <= getLastColumn(i); ++j) {
+                at(i, j) = matrix[i][j];
+            }
+        }
+    }
+
+    /**
+     * Konštruktor, ktorý vytvorí pásovú maticu P * A * P^T zo symetricky permutovanej riedkej matice A
+     * (prvok (p, q) je prvok (order[p], order[q]) matice A). Symetrická permutácia nemení determinant.
+     *
+     * @param matrix referencia na riedku maticu
+     * @param order nové poradie riadkov a stĺpcov (order[p] je pôvodný index p-teho riadku a stĺpca)
+     */
+    BandMatrix(const SparseMatrix<T>& matrix, const std::vector<int>& order) : BandMatrix(matrix.getSize(), 0, 0) {
+        std::vector<int> positions(size_);
+        for (int p = 0; p < size_; ++p) {
+            positions[order[p]] = p;
+        }
+        int lowerBandwidth = 0;
+        int upperBandwidth = 0;
+        for (int row = 0; row < size_; ++row) {
+            for (int k = matrix.getRowStarts()[row]; k < matrix.getRowStarts()[row + 1]; ++k) {
+                int distance = positions[matrix.getColumnIndices()[k]] - positions[row];
+                lowerBandwidth = std::max(lowerBandwidth, -distance);
+                upperBandwidth = std::max(upperBandwidth, distance);
+            }
+        }
+        *this = BandMatrix(size_, lowerBandwidth, upperBandwidth);
+        for (int row = 0; row < size_; ++row) {
+            for (int k = matrix.getRowStarts()[row]; k < matrix.getRowStarts()[row + 1]; ++k) {
+                at(positions[row], positions[matrix.getColumnIndices()[k]]) = matrix.getValues()[k];
+            }
+        }
+    }
+
+    /**
+     * Metóda generateValues slúži na vygenerovanie hodnôt prvkov pásma. Prechádzajú sa iba prvky v pásme v rovnakom poradí
+     * ako v hustej matici, takže generátor v pásovom režime s rovnakou šírkou pásma vygeneruje rovnakú maticu ako
+     * Matrix::generateValues (prvky pásma mimo pásma generátora sú nulové).
+     *
+     * @tparam G dátový typ generovaných dát
+     * @param generator referencia na generátor, ktorý generuje hodnoty pre prvky matice
+     */
+    template<typename G>
+    void generateValues(Generator<G>& generator) {
+        for (int i = 0; i < size_; ++i) {
+            for (int j = getFirstColumn(i); j <= getLastColumn(i); ++j) {
+                at(i, j) = generator.generate(i, j);
+            }
+        }
+    }
+
+    /**
+     * Getter pre stupeň (veľkosť) štvorcovej matice.
+     *
+     * @return stupeň (veľkosť) štvorcovej matice
+     */
+    int getSize() const {
+        return size_;
+    }
+
+    /**
+     * Getter pre počet diagonál pod hlavnou diagonálou.
+     *
+     * @return dolná šírka pásma
+     */
+    int getLowerBandwidth() const {
+        return lowerBandwidth_;
+    }
+
+    /**
+     * Getter pre počet diagonál nad hlavnou diagonálou.
+     *
+     * @return horná šírka pásma
+     */
+    int getUpperBandwidth() const {
+        return upperBandwidth_;
+    }
+
+    /**
+     * Metóda getRow vráti uložené prvky riadku: prvok stĺpca j je na indexe j - row + lowerBandwidth
+     * (lowerBandwidth + upperBandwidth + 1 prvkov, prvky mimo matice sú nulové).
+     *
+     * @param row index riadku
+     * @return ukazovateľ na prvky riadku v pásme
+     */
+    const T* getRow(int row) const {
+        return values_.data() + static_cast<std::size_t>(row) * width_;
+    }
+
+    /**
+     * Operátor () slúži na čítanie prvku matice.
+     *
+     * @param row index riadku
+     * @param column index stĺpca
+     * @return hodnota prvku (0 mimo pásma)
+     */
+    T operator()(int row, int column) const {
+        if (column < row - lowerBandwidth_ || column > row + upperBandwidth_) {
+            return T(0);
+        }
+        return getRow(row)[column - row + lowerBandwidth_];
+    }
+
+private:
+    /**
+     * Metóda at vráti referenciu na prvok v pásme.
+     *
+     * @param row index riadku
+     * @param column index stĺpca (v pásme)
+     * @return referencia na prvok
+     */
+    T& at(int row, int column) {
+        return values_[static_cast<std::size_t>(row) * width_ + column - row + lowerBandwidth_];
+    }
+
+    /**
+     * Metóda getFirstColumn vráti prvý stĺpec riadku v pásme.
+     *
+     * @param row index riadku
+     * @return prvý stĺpec v pásme
+     */
+    int getFirstColumn(int row) const {
+        return std::max(row - lowerBandwidth_, 0);
+    }
+
+    /**
+     * Metóda getLastColumn vráti posledný stĺpec riadku v pásme.
+     *
+     * @param row index riadku
+     * @return posledný stĺpec v pásme
+     */
+    int getLastColumn(int row) const {
+        return std::min(row + upperBandwidth_, size_ - 1);
+    }
+
+    /**
+     * Metóda measureLowerBandwidth zistí najväčšiu vzdialenosť nenulového prvku pod hlavnou diagonálou.
+     *
+     * @param matrix referencia na hustú maticu
+     * @return dolná šírka pásma
+     */
+    static int measureLowerBandwidth(Matrix<T>& matrix) {
+        int bandwidth = 0;
+        for (int i = 0; i < matrix.getSize(); ++i) {
+            for (int j = 0; j < i - bandwidth; ++j) {
+                if (matrix[i][j] != 0) {
+                    bandwidth = i - j;
+                    break;
+                }
+            }
+        }
+        return bandwidth;
+    }
+
+    /**
+     * Metóda measureUpperBandwidth zistí najväčšiu vzdialenosť nenulového prvku nad hlavnou diagonálou.
+     *
+     * @param matrix referencia na hustú maticu
+     * @return horná šírka pásma
+     */
+    static int measureUpperBandwidth(Matrix<T>& matrix) {
+        int bandwidth = 0;
+        for (int i = 0; i < matrix.getSize(); ++i) {
+            for (int j = matrix.getSize() - 1; j > i + bandwidth; --j) {
+                if (matrix[i][j] != 0) {
+                    bandwidth = j - i;
+                    break;
+                }
+            }
+        }
+        return bandwidth;
+    }
+};
+
+#endif
@@ -0,0 +1,391 @@
+#ifndef BAKALARSKAPRACA_BIGINTEGER_H
+#define BAKALARSKAPRACA_BIGINTEGER_H
+
+#include <algorithm>
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+// 128-bitové celé čísla podporujú iba kompilátory GCC a Clang
+#if defined(__SIZEOF_INT128__)
+#define BAKALARSKAPRACA_INT128 1
+#endif
+
+/**
+ * Trieda BigInteger predstavuje celé číslo s ľubovoľným počtom cifier.
+ * Absolútna hodnota je uložená ako postupnosť 32-bitových cifier od najnižšej, nula nemá žiadnu cifru.
+ * Slúži na presné výpočty determinantov celočíselných matíc, ktoré sa nezmestia do 64 (128) bitov.
+ */
+class BigInteger {
+private:
+    std::vector<std::uint32_t> digits_;     // cifry absolútnej hodnoty v základe 2^32 (od najnižšej)
+    bool negative_;                         // či je číslo záporné (nula nie je záporná)
+public:
+    /**
+     * Default konštruktor vytvorí nulu.
+     */
+    BigInteger() : negative_(false) {};
+
+    /**
+     * Konštruktor z 64-bitového celého čísla.
+     *
+     * @param value hodnota
+     */
+    BigInteger(long long value) : negative_(value < 0) {
+        unsigned long long magnitude = value < 0 ? 0ULL - static_cast<unsigned long long>(value) : static_cast<unsigned long long>(value);
+        while (magnitude != 0) {
+            digits_.push_back(static_cast<std::uint32_t>(magnitude));
+            magnitude >>= 32;
+        }
+    }
+
+    /**
+     * Konštruktor z ostatných celočíselných typov s najviac 64 bitmi.
+     *
+     * @tparam I celočíselný typ
+     * @param value hodnota
+     */
+    template<typename I, typename = std::enable_if_t<std::is_integral_v<I> && sizeof(I) <= sizeof(long long)>>
+    BigInteger(I value) : BigInteger(static_cast<long long>(value)) {};
+
+#ifdef BAKALARSKAPRACA_INT128
+    /**
+     * Konštruktor zo 128-bitového celého čísla.
+     *
+     * @param value hodnota
+     */
+    BigInteger(__int128 value) : negative_(value < 0) {
+        unsigned __int128 magnitude = value < 0 ? 0 - static_cast<unsigned __int128>(value) : static_cast<unsigned __int128>(value);
+        while (magnitude != 0) {
+            digits_.push_back(static_cast<std::uint32_t>(magnitude));
+            magnitude >>= 32;
+        }
+    }
+#endif
+
+    /**
+     * Metóda isZero zistí, či je číslo nulové.
+     *
+     * @return či je číslo nula (boolean)
+     */
+    bool isZero() const {
+        return digits_.empty();
+    }
+
+    /**
+     * Metóda isNegative zistí, či je číslo záporné.
+     *
+     * @return či je číslo záporné (boolean)
+     */
+    bool isNegative() const {
+        return negative_;
+    }
+
+    /**
+     * Metóda remainder vráti zvyšok po delení kladným číslom (vždy nezáporný, aj pre záporné čísla).
+     *
+     * @param divisor nenulový deliteľ
+     * @return zvyšok z intervalu [0, divisor)
+     */
+    std::uint32_t remainder(std::uint32_t divisor) const {
+        std::uint64_t result = 0;
+        for (int i = static_cast<int>(digits_.size()) - 1; i >= 0; --i) {
+            result = ((result << 32) | digits_[i]) % divisor;
+        }
+        return negative_ && result != 0 ? static_cast<std::uint32_t>(divisor - result) : static_cast<std::uint32_t>(result);
+    }
+
+    /**
+     * Metóda toDouble vráti približnú hodnotu čísla (pri príliš veľkých číslach nekonečno).
+     *
+     * @return hodnota čísla v type double
+     */
+    double toDouble() const {
+        double result = 0;
+        for (int i = static_cast<int>(digits_.size()) - 1; i >= 0; --i) {
+            result = result * 4294967296.0 + digits_[i];
+        }
+        return negative_ ? -result : result;
+    }
+
+    /**
+     * Metóda toString vráti desiatkový zápis čísla.
+     *
+     * @return desiatkový zápis
+     */
+    std::string toString() const {
+        if (isZero()) {
+            return "0";
+        }
+        std::string result;
+        std::vector<std::uint32_t> magnitude = digits_;
+        while (!magnitude.empty()) {
+            // delenie 10^9 dáva naraz 9 desiatkových cifier
+            std::uint32_t remainder = divideMagnitudeBySmall(magnitude, 1000000000U);
+            for (int i = 0; i < 9 && (!magnitude.empty() || remainder != 0); ++i) {
+                result.push_back(static_cast<char>('0' + remainder % 10));
+                remainder /= 10;
+            }
+        }
+        if (negative_) {
+            result.push_back('-');
+        }
+        std::reverse(result.begin(), result.end());
+        return result;
+    }
+
+    BigInteger operator-() const {
+        BigInteger result = *this;
+        result.negative_ = !result.isZero() && !negative_;
+        return result;
+    }
+
+    BigInteger operator+(const BigInteger& other) const {
+        if (negative_ == other.negative_) {
+            return BigInteger(addMagnitudes(digits_, other.digits_), negative_);
+        }
+        // rôzne znamienka: od väčšej absolútnej hodnoty sa odčíta menšia
+        if (compareMagnitudes(digits_, other.digits_) >= 0) {
+            return BigInteger(subtractMagnitudes(digits_, other.digits_), negative_);
+        }
+        return BigInteger(subtractMagnitudes(other.digits_, digits_), other.negative_);
+    }
+
+    BigInteger operator-(const BigInteger& other) const {
+        return *this + (-other);
+    }
+
+    BigInteger operator*(const BigInteger& other) const {
+        if (isZero() || other.isZero()) {
+            return BigInteger();
+        }
+        std::vector<std::uint32_t> product(digits_.size() + other.digits_.size(), 0);
+        for (std::size_t i = 0; i < digits_.size(); ++i) {
+            std::uint64_t carry = 0;
+            for (std::size_t j = 0; j < other.digits_.size(); ++j) {
+                std::uint64_t current = static_cast<std::uint64_t>(digits_[i]) * other.digits_[j] + product[i + j] + carry;
+                product[i + j] = static_cast<std::uint32_t>(current);
+                carry = current >> 32;
+            }
+            product[i + other.digits_.size()] = static_cast<std::uint32_t>(carry);
+        }
+        return BigInteger(std::move(product), negative_ != other.negative_);
+    }
+
+    /**
+     * Operátor delenia so zaokrúhlením smerom k nule (ako pri vstavaných celočíselných typoch).
+     * Delenie nulou vypíše chybu a vráti nulu.
+     */
+    BigInteger operator/(const BigInteger& other) const {
+        if (other.isZero()) {
+            std::cerr << "Division of the big integer by zero." << std::endl;
+            return BigInteger();
+        }
+        if (compareMagnitudes(digits_, other.digits_) < 0) {
+            return BigInteger();
+        }
+        std::vector<std::uint32_t> quotient;
+        if (other.digits_.size() == 1) {
+            quotient = digits_;
+            divideMagnitudeBySmall(quotient, other.digits_[0]);
+        } else {
+            quotient = divideMagnitudes(digits_, other.digits_);
+        }
+        return BigInteger(std::move(quotient), negative_ != other.negative_);
+    }
+
+    BigInteger& operator+=(const BigInteger& other) {
+        return *this = *this + other;
+    }
+
+    BigInteger& operator-=(const BigInteger& other) {
+        return *this = *this - other;
+    }
+
+    BigInteger& operator*=(const BigInteger& other) {
+        return *this = *this * other;
+    }
+
+    BigInteger& operator/=(const BigInteger& other) {
+        return *this = *this / other;
+    }
+
+    bool operator==(const BigInteger& other) const {
+        return negative_ == other.negative_ && digits_ == other.digits_;
+    }
+
+    bool operator!=(const BigInteger& other) const {
+        return !(*this == other);
+    }
+
+    bool operator<(const BigInteger& other) const {
+        if (negative_ != other.negative_) {
+            return negative_;
+        }
+        int comparison = compareMagnitudes(digits_, other.digits_);
+        return negative_ ? comparison > 0 : comparison < 0;
+    }
+
+    bool operator>(const BigInteger& other) const {
+        return other < *this;
+    }
+
+    friend std::ostream& operator<<(std::ostream& stream, const BigInteger& value) {
+        return stream << value.toString();
+    }
+
+private:
+    /**
+     * Konštruktor z absolútnej hodnoty a znamienka. Odstráni nulové najvyššie cifry.
+     *
+     * @param digits cifry absolútnej hodnoty
+     * @param negative či je číslo záporné
+     */
+    BigInteger(std::vector<std::uint32_t>&& digits, bool negative) : digits_(std::move(digits)), negative_(negative) {
+        trim();
+    }
+
+    /**
+     * Metóda trim odstráni nulové najvyššie cifry a nule nastaví kladné znamienko.
+     */
+    void trim() {
+        while (!digits_.empty() && digits_.back() == 0) {
+            digits_.pop_back();
+        }
+        if (digits_.empty()) {
+            negative_ = false;
+        }
+    }
+
+    static int compareMagnitudes(const std::vector<std::uint32_t>& first, const std::vector<std::uint32_t>& second) {
+        if (first.size() != second.size()) {
+            return first.size() < second.size() ? -1 : 1;
+        }
+        for (int i = static_cast<int>(first.size()) - 1; i >= 0; --i) {
+            if (first[i] != second[i]) {
+                return first[i] < second[i] ? -1 : 1;
+            }
+        }
+        return 0;
+    }
+
+    static std::vector<std::uint32_t> addMagnitudes(const std::vector<std::uint32_t>& first, const std::vector<std::uint32_t>& second) {
+        const std::vector<std::uint32_t>& longer = first.size() >= second.size() ? first : second;
+        const std::vector<std::uint32_t>& shorter = first.size() >= second.size() ? second : first;
+        std::vector<std::uint32_t> result(longer.size() + 1, 0);
+        std::uint64_t carry = 0;
+        for (std::size_t i = 0; i < longer.size(); ++i) {
+            std::uint64_t current = static_cast<std::uint64_t>(longer[i]) + (i < shorter.size() ? shorter[i] : 0) + carry;
+            result[i] = static_cast<std::uint32_t>(current);
+            carry = current >> 32;
+        }
+        result[longer.size()] = static_cast<std::uint32_t>(carry);
+        return result;
+    }
+
+    /**
+     * Metóda subtractMagnitudes odčíta absolútne hodnoty (prvá musí byť aspoň taká veľká ako druhá).
+     */
+    static std::vector<std::uint32_t> subtractMagnitudes(const std::vector<std::uint32_t>& first, const std::vector<std::uint32_t>& second) {
+        std::vector<std::uint32_t> result(first.size(), 0);
+        std::int64_t borrow = 0;
+        for (std::size_t i = 0; i < first.size(); ++i) {
+            std::int64_t current = static_cast<std::int64_t>(first[i]) - (i < second.size() ? second[i] : 0) - borrow;
+            borrow = current < 0 ? 1 : 0;
+            result[i] = static_cast<std::uint32_t>(current + (borrow << 32));
+        }
+        return result;
+    }
+
+    /**
+     * Metóda divideMagnitudeBySmall vydelí absolútnu hodnotu jednou cifrou (na mieste).
+     *
+     * @param magnitude delenec, po skončení podiel bez nulových najvyšších cifier
+     * @param divisor nenulový deliteľ
+     * @return zvyšok po delení
+     */
+    static std::uint32_t divideMagnitudeBySmall(std::vector<std::uint32_t>& magnitude, std::uint32_t divisor) {
+        std::uint64_t remainder = 0;
+        for (int i = static_cast<int>(magnitude.size()) - 1; i >= 0; --i) {
+            std::uint64_t current = (remainder << 32) | magnitude[i];
+            magnitude[i] = static_cast<std::uint32_t>(current / divisor);
+            remainder = current % divisor;
+        }
+        while (!magnitude.empty() && magnitude.back() == 0) {
+            magnitude.pop_back();
+        }
+        return static_cast<std::uint32_t>(remainder);
+    }
+
+    /**
+     * Metóda divideMagnitudes vydelí absolútne hodnoty (deliteľ má aspoň dve cifry) algoritmom D podľa D. E. Knutha.
+     *
+     * @param dividend delenec
+     * @param divisor deliteľ
+     * @return podiel
+     */
+    static std::vector<std::uint32_t> divideMagnitudes(const std::vector<std::uint32_t>& dividend, const std::vector<std::uint32_t>& divisor) {
+        std::size_t n = divisor.size();
+        std::size_t m = dividend.size() - n;
+        // normalizácia: najvyšší bit deliteľa musí byť nastavený
+        int shift = 0;
+        while ((divisor.back() << shift & 0x80000000U) == 0) {
+            shift++;
+        }
+        std::vector<std::uint32_t> v(n), u(dividend.size() + 1);
+        for (std::size_t i = n - 1; i > 0; --i) {
+            v[i] = (divisor[i] << shift) | (shift == 0 ? 0 : divisor[i - 1] >> (32 - shift));
+        }
+        v[0] = divisor[0] << shift;
+        u[dividend.size()] = shift == 0 ? 0 : dividend.back() >> (32 - shift);
+        for (std::size_t i = dividend.size() - 1; i > 0; --i) {
+            u[i] = (dividend[i] << shift) | (shift == 0 ? 0 : dividend[i - 1] >> (32 - shift));
+        }
+        u[0] = dividend[0] << shift;
+
+        std::vector<std::uint32_t> quotient(m + 1, 0);
+        for (int j = static_cast<int>(m); j >= 0; --j) {
+            // odhad cifry podielu z dvoch najvyšších cifier
+            std::uint64_t numerator = (static_cast<std::uint64_t>(u[j + n]) << 32) | u[j + n - 1];
+            std::uint64_t estimate = numerator / v[n - 1];
+            std::uint64_t remainder = numerator % v[n - 1];
+            while (estimate > 0xFFFFFFFFULL || estimate * v[n - 2] > ((remainder << 32) | u[j + n - 2])) {
+                estimate--;
+                remainder += v[n - 1];
+                if (remainder > 0xFFFFFFFFULL) {
+                    break;
+                }
+            }
+            // odčítanie estimate * v od u[j..j+n]
+            std::int64_t borrow = 0;
+            std::uint64_t carry = 0;
+            for (std::size_t i = 0; i < n; ++i) {
+                std::uint64_t product = estimate * v[i] + carry;
+                carry = product >> 32;
+                std::int64_t current = static_cast<std::int64_t>(u[i + j]) - static_cast<std::int64_t>(product & 0xFFFFFFFFULL) - borrow;
+                borrow = current < 0 ? 1 : 0;
+                u[i + j] = static_cast<std::uint32_t>(current + (borrow << 32));
+            }
+            std::int64_t current = static_cast<std::int64_t>(u[j + n]) - static_cast<std::int64_t>(carry) - borrow;
+            u[j + n] = static_cast<std::uint32_t>(current);
+            // odhad bol o jedna väčší, deliteľ sa pripočíta späť
+            if (current < 0) {
+                estimate--;
+                std::uint64_t addCarry = 0;
+                for (std::size_t i = 0; i < n; ++i) {
+                    std::uint64_t sum = static_cast<std::uint64_t>(u[i + j]) + v[i] + addCarry;
+                    u[i + j] = static_cast<std::uint32_t>(sum);
+                    addCarry = sum >> 32;
+                }
+                u[j + n] += static_cast<std::uint32_t>(addCarry);
+            }
+            quotient[j] = static_cast<std::uint32_t>(estimate);
+        }
+        return quotient;
+    }
+};
+
+#endif
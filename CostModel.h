@@ -0,0 +1,324 @@
+#ifndef BAKALARSKAPRACA_COSTMODEL_H
+#define BAKALARSKAPRACA_COSTMODEL_H
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <sstream>
+#include <string>
+#include <vector>
+
+/**
+ * Enum costGrowth, ktorý reprezentuje tvar krivky ceny výpočtovej metódy v závislosti od stupňa matice.
+ */
+enum costGrowth { CUBIC_GROWTH, FACTORIAL_GROWTH, EXPONENTIAL_GROWTH, HYBRID_GROWTH, BAND_GROWTH };
+
+/**
+ * Štruktúra costCurve uchováva kalibrovanú krivku ceny jednej výpočtovej metódy: čas = overhead + scale * práca(n, hustota núl).
+ */
+struct costCurve {
+    int method;             // výpočtová metóda (číslo v menu aplikácie)
+    costGrowth growth;      // tvar krivky (odhad počtu operácií)
+    bool exact;             // či metóda počíta celočíselné matice presne (kalibruje sa na celočíselných maticiach)
+    double overhead;        // konštantná cena volania v sekundách
+    double scale;           // cena jednej jednotky práce v sekundách
+    bool calibrated;        // či je krivka nakalibrovaná
+};
+
+/**
+ * Trieda CostModel predstavuje model ceny výpočtových metód, podľa ktorého sa vyberie najrýchlejšia metóda pre maticu.
+ * Práca metódy sa odhaduje z tvaru jej zložitosti: eliminačné metódy O(n^3), Laplaceov rozvoj a Leibnitzov vzorec
+ * súčinom vetvení po úrovniach (nulové prvky vetvy odrežú, vetvenie na úrovni k je preto asi k * (1 - hustota núl)),
+ * rozvoj s podmnožinami O(n * 2^n), hybridný rozvoj vetvením až po stupeň cutoff a LU rozkladom minorov O(cutoff^3)
+ * a pásový LU rozklad prevodom hustej matice O(n^2) a rozkladom pásma šírky b O(n * b^2).
+ * Konštanty kriviek sa zmerajú na aktuálnom počítači (dve veľkosti matíc pre každú metódu) a uložia sa do súboru
+ * spolu s podpisom prostredia (inštrukčná sada, počet vlákien), pri zmene prostredia sa model nakalibruje znovu.
+ * Krivky sa merajú na maticiach typu double (presné metódy na celočíselných), pre typ float sa použijú rovnaké krivky.
+ */
+class CostModel {
+private:
+    static constexpr int CALIBRATION_REPETITIONS = 3;   // počet meraní každého bodu kalibrácie (použije sa minimum)
+    static constexpr int HYBRID_MAX_CUTOFF = 8;         // najväčší stupeň minoru, od ktorého môže hybridný rozvoj pokračovať LU rozkladom
+
+    std::string fileName_;                  // meno súboru s uloženými krivkami
+    std::vector<costCurve> curves_;         // krivky registrovaných metód
+public:
+    static constexpr int HYBRID_CALIBRATION_CUTOFF = 6;     // stupeň minoru, s ktorým sa kalibruje hybridný rozvoj
+    static constexpr int BAND_CALIBRATION_BANDWIDTH = 8;    // šírka pásma matíc, na ktorých sa kalibruje pásový LU rozklad
+
+    /**
+     * Konštruktor pre model s uložením do súboru.
+     *
+     * @param fileName meno súboru s uloženými krivkami
+     */
+    explicit CostModel(const std::string& fileName) : fileName_(fileName) {};
+
+    /**
+     * Metóda addMethod zaregistruje výpočtovú metódu, ktorú môže model vybrať.
+     *
+     * @param method výpočtová metóda
+     * @param growth tvar krivky ceny
+     * @param exact či metóda počíta celočíselné matice presne (boolean)
+     */
+    void addMethod(int method, costGrowth growth, bool exact) {
+        curves_.push_back({ method, growth, exact, 0, 0, false });
+    }
+
+    /**
+     * Getter pre meno súboru s uloženými krivkami.
+     *
+     * @return meno súboru
+     */
+    const std::string& getFileName() const {
+        return fileName_;
+    }
+
+    /**
+     * Metóda isCalibrated zistí, či sú nakalibrované krivky všetkých registrovaných metód.
+     *
+     * @return či je model nakalibrovaný (boolean)
+     */
+    bool isCalibrated() const {
+        return std::all_of(curves_.begin(), curves_.end(), [](const costCurve& curve) { return curve.calibrated; });
+    }
+
+    /**
+     * Metóda load načíta krivky zo súboru. Krivky sa použijú, iba ak súbor vznikol v rovnakom prostredí (podpis sa zhoduje)
+     * a obsahuje všetky registrované metódy.
+     *
+     * @param signature podpis prostredia (napr. inštrukčná sada a počet vlákien)
+     * @return či sa krivky načítali (boolean)
+     */
+    bool load(const std::string& signature) {
+        std::ifstream inputFile(fileName_);
+        if (!inputFile.is_open()) {
+            return false;
+        }
+        std::string line;
+        if (!std::getline(inputFile, line) || line != "Cost model;" + signature) {
+            return false;
+        }
+        std::getline(inputFile, line);      // hlavička stĺpcov
+        std::vector<costCurve> loaded = curves_;
+        while (std::getline(inputFile, line)) {
+            std::istringstream fields(line);
+            int method;
+            double overhead, scale;
+            char separator;
+            if (!(fields >> method >> separator >> overhead >> separator >> scale)) {
+                std::cerr << "Invalid line in the cost model file " << fileName_ << ": " << line << std::endl;
+                return false;
+            }
+            for (costCurve& curve : loaded) {
+                if (curve.method == method) {
+                    curve.overhead = overhead;
+                    curve.scale = scale;
+                    curve.calibrated = true;
+                }
+            }
+        }
+        if (!std::all_of(loaded.begin(), loaded.end(), [](const costCurve& curve) { return curve.calibrated; })) {
+            return false;
+        }
+        curves_ = loaded;
+        return true;
+    }
+
+    /**
+     * Metóda save uloží krivky do súboru (existujúci súbor sa prepíše).
+     *
+     * @param signature podpis prostredia
+     */
+    void save(const std::string& signature) const {
+        std::ofstream outputFile(fileName_, std::ios_base::trunc);
+        if (!outputFile.is_open()) {
+            std::cerr << "Unable to open the file: " << fileName_ << std::endl;
+            return;
+        }
+        outputFile << std::setprecision(std::numeric_limits<double>::max_digits10);
+        outputFile << "Cost model;" << signature << "\n";
+        outputFile << "Method;Overhead [s];Scale [s]\n";
+        for (const costCurve& curve : curves_) {
+            outputFile << curve.method << ";" << curve.overhead << ";" << curve.scale << "\n";
+        }
+    }
+
+    /**
+     * Metóda calibrate zmeria každú registrovanú metódu na dvoch veľkostiach matíc (hustých, bez núl, pásový LU rozklad
+     * na pásových maticiach so šírkou pásma BAND_CALIBRATION_BANDWIDTH) a z rozdielu
+     * časov určí cenu jednotky práce a konštantnú cenu volania.
+     *
+     * @tparam F typ merania
+     * @param measure meranie measure(metóda, stupeň, presná) vráti čas výpočtu determinantu náhodnej matice v sekundách
+     */
+    template<typename F>
+    void calibrate(const F& measure) {
+        for (costCurve& curve : curves_) {
+            int smallSize, largeSize;
+            getCalibrationSizes(curve, smallSize, largeSize);
+            double smallTime = measureMinimum(measure, curve, smallSize);
+            double largeTime = measureMinimum(measure, curve, largeSize);
+            double smallWork = calibrationWork(curve.growth, smallSize);
+            double largeWork = calibrationWork(curve.growth, largeSize);
+            curve.scale = (largeTime - smallTime) / (largeWork - smallWork);
+            curve.overhead = smallTime - curve.scale * smallWork;
+            // merania zaťažené šumom môžu dať nezmyselnú priamku, vtedy sa použije priamka cez počiatok
+            if (curve.scale <= 0 || curve.overhead < 0) {
+                curve.scale = largeTime / largeWork;
+                curve.overhead = 0;
+            }
+            curve.calibrated = true;
+        }
+    }
+
+    /**
+     * Metóda select vyberie metódu s najmenším odhadovaným časom pre maticu zadaného stupňa a hustoty núl.
+     *
+     * @param size stupeň matice
+     * @param zeroDensity podiel nulových prvkov matice
+     * @param bandwidth najväčšia vzdialenosť nenulového prvku od hlavnej diagonály
+     * @param integral či má matica celočíselné prvky (boolean)
+     * @param requireExact či sa vyžaduje presný výsledok celočíselnej matice (boolean)
+     * @param hybridCutoff výstup: stupeň minoru, od ktorého má hybridný rozvoj pokračovať LU rozkladom
+     * @param estimatedTime výstup: odhadovaný čas vybranej metódy v sekundách
+     * @return vybraná metóda (0, ak nie je žiadna vhodná)
+     */
+    int select(int size, double zeroDensity, int bandwidth, bool integral, bool requireExact, int& hybridCutoff, double& estimatedTime) const {
+        int selected = 0;
+        estimatedTime = std::numeric_limits<double>::infinity();
+        hybridCutoff = size;
+        for (const costCurve& curve : curves_) {
+            // presné metódy počítajú iba celočíselné matice, presný výsledok vedia zaručiť iba ony
+            if ((curve.exact && !integral) || (!curve.exact && integral && requireExact)) {
+                continue;
+            }
+            int cutoff = curve.growth == HYBRID_GROWTH ? bestHybridCutoff(size, zeroDensity) : size;
+            if (cutoff == 0) {
+                continue;
+            }
+            double time = curve.overhead + curve.scale * work(curve.growth, size, zeroDensity, cutoff, bandwidth);
+            if (selected == 0 || time < estimatedTime) {
+                selected = curve.method;
+                estimatedTime = time;
+                hybridCutoff = cutoff;
+            }
+        }
+        return selected;
+    }
+
+private:
+    /**
+     * Metóda getCalibrationSizes určí dve veľkosti matíc, na ktorých sa metóda zmeria (výpočet trvá rádovo milisekundy).
+     *
+     * @param curve krivka metódy
+     * @param smallSize výstup: menšia veľkosť
+     * @param largeSize výstup: väčšia veľkosť
+     */
+    static void getCalibrationSizes(const costCurve& curve, int& smallSize, int& largeSize) {
+        switch (curve.growth) {
+            case CUBIC_GROWTH:
+                // presné metódy pracujú s veľkými číslami, merajú sa preto na menších maticiach
+                smallSize = curve.exact ? 16 : 64;
+                largeSize = curve.exact ? 48 : 256;
+                break;
+            case FACTORIAL_GROWTH: smallSize = 7; largeSize = 9; break;
+            case EXPONENTIAL_GROWTH: smallSize = 12; largeSize = 16; break;
+            case BAND_GROWTH: smallSize = 128; largeSize = 512; break;
+            default: smallSize = 9; largeSize = 11; break;
+        }
+    }
+
+    /**
+     * Metóda measureMinimum zmeria metódu na matici zadaného stupňa niekoľkokrát a vráti najkratší čas.
+     *
+     * @tparam F typ merania
+     * @param measure meranie
+     * @param curve krivka metódy
+     * @param size stupeň matice
+     * @return najkratší čas v sekundách
+     */
+    template<typename F>
+    static double measureMinimum(const F& measure, const costCurve& curve, int size) {
+        double best = std::numeric_limits<double>::infinity();
+        for (int i = 0; i < CALIBRATION_REPETITIONS; ++i) {
+            best = std::min(best, measure(curve.method, size, curve.exact));
+        }
+        return best;
+    }
+
+    /**
+     * Metóda calibrationWork vráti prácu metódy na hustej kalibračnej matici.
+     *
+     * @param growth tvar krivky ceny
+     * @param size stupeň matice
+     * @return odhadovaná práca
+     */
+    static double calibrationWork(costGrowth growth, int size) {
+        return work(growth, size, 0, growth == HYBRID_GROWTH ? HYBRID_CALIBRATION_CUTOFF : size, BAND_CALIBRATION_BANDWIDTH);
+    }
+
+    /**
+     * Metóda work odhadne prácu metódy (počet operácií až na konštantu) pre maticu zadaného stupňa a hustoty núl.
+     *
+     * @param growth tvar krivky ceny
+     * @param size stupeň matice
+     * @param zeroDensity podiel nulových prvkov matice
+     * @param cutoff stupeň minoru, od ktorého hybridný rozvoj pokračuje LU rozkladom
+     * @param bandwidth najväčšia vzdialenosť nenulového prvku od hlavnej diagonály
+     * @return odhadovaná práca
+     */
+    static double work(costGrowth growth, int size, double zeroDensity, int cutoff, int bandwidth) {
+        double n = size;
+        double b = bandwidth;
+        switch (growth) {
+            case CUBIC_GROWTH: return n * n * n;
+            case FACTORIAL_GROWTH: return n * expansionBranches(size, 1, zeroDensity);
+            case EXPONENTIAL_GROWTH: return n * std::pow(2.0, n);
+            case BAND_GROWTH: return n * n + n * (b + 1) * (2 * b + 1);
+            default: return expansionBranches(size, cutoff, zeroDensity) * (static_cast<double>(cutoff) * cutoff * cutoff + n);
+        }
+    }
+
+    /**
+     * Metóda expansionBranches odhadne počet minorov stupňa lowestSize v rozvoji matice. Rozvíja sa podľa riadku
+     * (stĺpca) s najviac nulami, na úrovni stupňa k sa preto vetví najviac na k * (1 - hustota núl) minorov (aspoň na jeden).
+     *
+     * @param size stupeň matice
+     * @param lowestSize stupeň minorov, pri ktorom rozvoj končí
+     * @param zeroDensity podiel nulových prvkov matice
+     * @return odhadovaný počet minorov
+     */
+    static double expansionBranches(int size, int lowestSize, double zeroDensity) {
+        double branches = 1;
+        for (int k = lowestSize + 1; k <= size; ++k) {
+            branches *= std::max(1.0, k * (1 - zeroDensity));
+        }
+        return branches;
+    }
+
+    /**
+     * Metóda bestHybridCutoff nájde stupeň minoru, pri ktorom má hybridný rozvoj najmenšiu odhadovanú prácu.
+     * Uvažujú sa iba minory do stupňa HYBRID_MAX_CUTOFF (bez aspoň jednej úrovne rozvoja je hybridný rozvoj len LU rozkladom).
+     *
+     * @param size stupeň matice
+     * @param zeroDensity podiel nulových prvkov matice
+     * @return stupeň minoru (0, ak je matica na rozvoj príliš malá)
+     */
+    static int bestHybridCutoff(int size, double zeroDensity) {
+        int best = 0;
+        double bestWork = std::numeric_limits<double>::infinity();
+        for (int cutoff = std::min(size - 1, HYBRID_MAX_CUTOFF); cutoff >= 1; --cutoff) {
+            double cutoffWork = work(HYBRID_GROWTH, size, zeroDensity, cutoff, size - 1);
+            if (cutoffWork < bestWork) {
+                best = cutoff;
+                bestWork = cutoffWork;
+            }
+        }
+        return best;
+    }
+};
+
+#endif
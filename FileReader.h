@@ -2,7 +2,9 @@
 #define BAKALARSKAPRACA_FILEREADER_H
 
 #include <string>
+#include <vector>
 #include "Matrix.h"
+#include "SparseMatrix.h"
 
 /**
  * Trieda FileReader slúži na čítanie údajov zo súboru.
@@ -67,6 +69,66 @@ public:
         }
     };
 
+    /**
+     * Metóda fillSparseMatrix slúži na načítanie prvkov riedkej matice zo súboru v rovnakom formáte ako hustá matica
+     * (všetky prvky po riadkoch), uložia sa iba nenulové prvky.
+     *
+     * @tparam T dátový typ prvkov matice
+     * @param matrix referencia na riedku maticu
+     */
+    template<typename T>
+    void fillSparseMatrix(SparseMatrix<T>& matrix) {
+        // kontrola, či je súbor otvorený
+        if (!inputFile_.is_open()) {
+            std::cerr << "Unable to open the file: " << fileName_ << std::endl;
+            return;
+        }
+
+        std::vector<T> row(matrix.getSize());
+        matrix.clear();
+        for (int i = 0; i < matrix.getSize(); ++i) {
+            for (int j = 0; j < matrix.getSize(); ++j) {
+                inputFile_ >> row[j];
+            }
+            matrix.setRow(i, row.data());
+        }
+    }
+
+    /**
+     * Metóda fillBatch slúži na načítanie všetkých matíc zo súboru s viacerými maticami rovnakého stupňa (až po koniec súboru).
+     * Prvky sa uložia po zložkách: prvok (i, j) matice m je na indexe (i * size + j) * počet matíc + m.
+     *
+     * @tparam T dátový typ prvkov matíc
+     * @param elements výstupné pole prvkov matíc
+     * @param size stupeň (veľkosť) matíc
+     * @return počet načítaných matíc
+     */
+    template<typename T>
+    std::size_t fillBatch(std::vector<T>& elements, int size) {
+        // kontrola, či je súbor otvorený
+        if (!inputFile_.is_open()) {
+            std::cerr << "Unable to open the file: " << fileName_ << std::endl;
+            return 0;
+        }
+
+        std::size_t matrixElements = static_cast<std::size_t>(size) * size;
+        std::vector<T> rowMajor;        // prvky matíc za sebou tak, ako sú v súbore
+        T value;
+        while (inputFile_ >> value) {
+            rowMajor.push_back(value);
+        }
+        if (rowMajor.size() % matrixElements != 0) {
+            std::cerr << "The file contains an incomplete matrix, it is ignored." << std::endl;
+        }
+        std::size_t count = rowMajor.size() / matrixElements;
+        elements.resize(matrixElements * count);
+        for (std::size_t m = 0; m < count; ++m) {
+            for (std::size_t e = 0; e < matrixElements; ++e) {
+                elements[e * count + m] = rowMajor[m * matrixElements + e];
+            }
+        }
+        return count;
+    }
 };
 
 
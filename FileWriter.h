@@ -2,8 +2,10 @@
 #define BAKALARSKAPRACA_FILEWRITER_H
 
 #include <string>
+#include <iomanip>
 #include <iostream>
 #include <fstream>
+#include <limits>
 
 /**
  * Trieda FileWriter slúži na zápis údajov do súboru.
@@ -1,6 +1,8 @@
 #ifndef BAKALARSKAPRACA_GENERATOR_H
 #define BAKALARSKAPRACA_GENERATOR_H
 
+#include <algorithm>
+#include <cstdlib>
 #include <iostream>
 #include <random>
 
@@ -18,6 +20,7 @@ private:
     std::uniform_real_distribution<double> zeroDistribution_;       // distribúcia rovnomerne náhodných čísel pre pravdepodobnosť vygenerovania 0
     double zeroProbability_;                                        // pravdepodobnosť vygenerovania 0
     unsigned int seed_;                                             // seed pre generátory
+    int bandwidth_;                                                 // počet nenulových diagonál na každej strane hlavnej diagonály (-1 pre plnú maticu)
 public:
     /**
      * Konštruktor pre generátor.
@@ -27,7 +30,7 @@ public:
      * @param zeroProbability pravdepodobnosť vygenerovania 0
      * @param seed seed
      */
-    Generator(double minValue, double maxValue, double zeroProbability, unsigned int seed) : numberDistribution_(minValue, maxValue), zeroProbability_(zeroProbability), zeroDistribution_(0.0, 1.0), seed_(seed) {
+    Generator(double minValue, double maxValue, double zeroProbability, unsigned int seed) : numberDistribution_(minValue, maxValue), zeroProbability_(zeroProbability), zeroDistribution_(0.0, 1.0), seed_(seed), bandwidth_(-1) {
         numberGenerator_ = std::default_random_engine(seed_);
         zeroGenerator_ = std::default_random_engine(seed_);
     }
@@ -52,6 +55,39 @@ public:
         }
         return randomNumber;
     }
+
+    /**
+     * Metóda generate slúži na generovanie hodnoty prvku na danej pozícii. V pásovom režime sú prvky mimo pásma nulové
+     * (a nespotrebujú náhodné číslo), takže matica generovaná iba v pásme má rovnaké prvky ako hustá matica.
+     *
+     * @param row index riadku
+     * @param column index stĺpca
+     * @return vygenerovaná hodnota
+     */
+    T generate(int row, int column) {
+        if (bandwidth_ >= 0 && std::abs(row - column) > bandwidth_) {
+            return 0;
+        }
+        return generate();
+    }
+
+    /**
+     * Setter pre šírku pásma generovaných matíc (pásový režim).
+     *
+     * @param bandwidth počet nenulových diagonál na každej strane hlavnej diagonály (-1 pre plnú maticu)
+     */
+    void setBandwidth(int bandwidth) {
+        bandwidth_ = std::max(bandwidth, -1);
+    }
+
+    /**
+     * Getter pre šírku pásma generovaných matíc.
+     *
+     * @return počet nenulových diagonál na každej strane hlavnej diagonály (-1 pre plnú maticu)
+     */
+    int getBandwidth() const {
+        return bandwidth_;
+    }
 };
 
 /**
@@ -66,6 +102,7 @@ private:
     std::uniform_real_distribution<double> zeroDistribution_;       // distribúcia rovnomerne náhodných čísel pre pravdepodobnosť vygenerovania 0
     double zeroProbability_;                                        // pravdepodobnosť vygenerovania 0
     unsigned int seed_;                                             // seed pre generátory
+    int bandwidth_;                                                 // počet nenulových diagonál na každej strane hlavnej diagonály (-1 pre plnú maticu)
 public:
     /**
      * Konštruktor pre generátor.
@@ -75,7 +112,7 @@ public:
      * @param zeroProbability pravdepodobnosť vygenerovania 0
      * @param seed seed
      */
-    Generator(int minValue, int maxValue, double zeroProbability, unsigned int seed) : numberDistribution_(minValue, maxValue), zeroProbability_(zeroProbability), zeroDistribution_(0.0, 1.0), seed_(seed) {
+    Generator(int minValue, int maxValue, double zeroProbability, unsigned int seed) : numberDistribution_(minValue, maxValue), zeroProbability_(zeroProbability), zeroDistribution_(0.0, 1.0), seed_(seed), bandwidth_(-1) {
         numberGenerator_ = std::default_random_engine(seed_);
         zeroGenerator_ = std::default_random_engine(seed_);
     }
@@ -100,6 +137,39 @@ public:
         }
         return randomNumber;
     }
+
+    /**
+     * Metóda generate slúži na generovanie hodnoty prvku na danej pozícii. V pásovom režime sú prvky mimo pásma nulové
+     * (a nespotrebujú náhodné číslo), takže matica generovaná iba v pásme má rovnaké prvky ako hustá matica.
+     *
+     * @param row index riadku
+     * @param column index stĺpca
+     * @return vygenerovaná hodnota
+     */
+    int generate(int row, int column) {
+        if (bandwidth_ >= 0 && std::abs(row - column) > bandwidth_) {
+            return 0;
+        }
+        return generate();
+    }
+
+    /**
+     * Setter pre šírku pásma generovaných matíc (pásový režim).
+     *
+     * @param bandwidth počet nenulových diagonál na každej strane hlavnej diagonály (-1 pre plnú maticu)
+     */
+    void setBandwidth(int bandwidth) {
+        bandwidth_ = std::max(bandwidth, -1);
+    }
+
+    /**
+     * Getter pre šírku pásma generovaných matíc.
+     *
+     * @return počet nenulových diagonál na každej strane hlavnej diagonály (-1 pre plnú maticu)
+     */
+    int getBandwidth() const {
+        return bandwidth_;
+    }
 };
 
 #endif
@@ -1,51 +1,107 @@
 #ifndef BAKALARSKAPRACA_MATRIX_H
 #define BAKALARSKAPRACA_MATRIX_H
 
+#include <cstddef>
+#include <cstring>
 #include <fstream>
 #include <iostream>
+#include <new>
+#include <type_traits>
 #include <vector>
 #include "Generator.h"
 
 /**
  * Trieda Matrix reprezentuje štvorcovú maticu.
  *
+ * Prvky matice sú uložené v jednom súvislom bloku pamäte zarovnanom na 64 bajtov (veľkosť cache line),
+ * kde každý riadok začína na zarovnanej adrese (riadky sú doplnené na násobok zarovnania).
+ * Prístup k riadkom ide cez tabuľku ukazovateľov, ktorá predstavuje permutáciu riadkov,
+ * vďaka čomu je výmena dvoch riadkov (std::swap(matrix[i], matrix[j])) operácia O(1).
+ *
  * @tparam T dátový typ prvkov matice
  */
 
 template<class T>
 class Matrix {
+    static_assert(std::is_trivially_copyable_v<T>, "Matrix requires trivially copyable elements.");
+public:
+    static constexpr std::size_t ALIGNMENT = 64;    // zarovnanie riadkov v bajtoch (veľkosť cache line)
 private:
-    int size_;      // stupeň (veľkosť) štvorcovej matice
-    T** matrix_;    // dvojité pole obsahujúce prvky matice
+    int size_;          // stupeň (veľkosť) štvorcovej matice
+    int stride_;        // dĺžka riadku v pamäti (počet prvkov vrátane doplnenia na zarovnanie)
+    void* memory_;      // jediný alokovaný blok pamäte (tabuľka riadkov + prvky matice)
+    T** rows_;          // tabuľka ukazovateľov na riadky (logické poradie riadkov)
+    T* data_;           // zarovnaný súvislý blok prvkov matice uložený po riadkoch
 public:
     /**
      * Konštruktor pre maticu.
-     * Inicializuje dvojité pole a nastaví všetky prvky na 0.
+     * Alokuje jeden zarovnaný blok pamäte a nastaví všetky prvky na 0.
+     * Nulovanie je možné vynechať, ak budú všetky prvky hneď prepísané (napr. metódou generateValues).
      *
      * @param size stupeň (veľkosť) štvorcovej matice
+     * @param initialize či sa majú prvky nastaviť na 0 (boolean)
      */
-    Matrix(int size) : size_(size) {
-        matrix_ = new T*[size_];
-        for (int i = 0; i < size_; ++i) {
-            matrix_[i] = new T[size_];
-        }
+    Matrix(int size, bool initialize = true) : size_(size) {
+        std::size_t elementsPerLine = ALIGNMENT / sizeof(T) > 0 ? ALIGNMENT / sizeof(T) : 1;
+        stride_ = static_cast<int>((size_ + elementsPerLine - 1) / elementsPerLine * elementsPerLine);
 
-        for (int i = 0; i < size_; ++i) {
-            for (int j = 0; j < size_; ++j) {
-                matrix_[i][j] = 0;
+        // tabuľka riadkov je uložená pred prvkami a je doplnená tak, aby prvky začínali na zarovnanej adrese
+        std::size_t tableBytes = (size_ * sizeof(T*) + ALIGNMENT - 1) / ALIGNMENT * ALIGNMENT;
+        std::size_t dataBytes = static_cast<std::size_t>(size_) * stride_ * sizeof(T);
+        memory_ = ::operator new(tableBytes + dataBytes, std::align_val_t(ALIGNMENT));
+        rows_ = static_cast<T**>(memory_);
+        data_ = reinterpret_cast<T*>(static_cast<char*>(memory_) + tableBytes);
+
+        resetRowOrder();
+        if (initialize) {
+            for (std::size_t i = 0; i < static_cast<std::size_t>(size_) * stride_; ++i) {
+                data_[i] = 0;
             }
         }
     };
 
+    /**
+     * Kopírovací konštruktor je zakázaný, kópia matice sa vytvára explicitne metódou clone.
+     */
+    Matrix(const Matrix&) = delete;
+    Matrix& operator=(const Matrix&) = delete;
+
+    /**
+     * Presúvací konštruktor pre maticu.
+     * Prevezme pamäť druhej matice, ktorá ostane prázdna (stupňa 0).
+     *
+     * @param other matica, ktorej pamäť sa preberá
+     */
+    Matrix(Matrix&& other) noexcept : size_(other.size_), stride_(other.stride_), memory_(other.memory_), rows_(other.rows_), data_(other.data_) {
+        other.release();
+    }
+
+    /**
+     * Presúvací operátor priradenia pre maticu.
+     * Uvoľní vlastnú pamäť a prevezme pamäť druhej matice, ktorá ostane prázdna (stupňa 0).
+     *
+     * @param other matica, ktorej pamäť sa preberá
+     * @return referencia na túto maticu
+     */
+    Matrix& operator=(Matrix&& other) noexcept {
+        if (this != &other) {
+            ::operator delete(memory_, std::align_val_t(ALIGNMENT));
+            size_ = other.size_;
+            stride_ = other.stride_;
+            memory_ = other.memory_;
+            rows_ = other.rows_;
+            data_ = other.data_;
+            other.release();
+        }
+        return *this;
+    }
+
     /**
      * Deštruktor pre maticu.
      * Uvoľní dynamicky alokovanú pamäť.
      */
     ~Matrix() {
-        for (int i = 0; i < size_; ++i) {
-            delete[] matrix_[i];
-        }
-        delete[] matrix_;
+        ::operator delete(memory_, std::align_val_t(ALIGNMENT));
     }
 
     /**
@@ -56,20 +112,50 @@ public:
      */
     template<typename G>
     void generateValues(Generator<G>& generator) {
+        // všetky prvky sa prepíšu, preto je možné obnoviť fyzické poradie riadkov
+        resetRowOrder();
         for (int i = 0; i < size_; ++i) {
             for (int j = 0; j < size_; ++j) {
-                matrix_[i][j] = generator.generate();
+                rows_[i][j] = generator.generate(i, j);
             }
         }
     }
 
+    /**
+     * Metóda clone vytvorí novú maticu s rovnakými prvkami.
+     * Riadky kópie sú uložené vo fyzickom poradí zodpovedajúcom logickému poradiu riadkov tejto matice.
+     *
+     * @return kópia matice
+     */
+    Matrix clone() {
+        Matrix copy(size_, false);
+        copy.copyFrom(*this);
+        return copy;
+    }
+
+    /**
+     * Metóda copyFrom prepíše prvky matice prvkami inej matice rovnakého stupňa bez alokácie pamäte.
+     *
+     * @param other matica, z ktorej sa kopírujú prvky
+     */
+    void copyFrom(Matrix& other) {
+        if (other.size_ != size_) {
+            std::cerr << "Unable to copy a matrix of a different size." << std::endl;
+            return;
+        }
+        resetRowOrder();
+        for (int i = 0; i < size_; ++i) {
+            std::memcpy(rows_[i], other.rows_[i], static_cast<std::size_t>(size_) * sizeof(T));
+        }
+    }
+
     /**
      * Metóda print slúži na výpis prvkov matice do konzoly.
      */
     void print() {
         for (int i = 0; i < size_; ++i) {
             for (int j = 0; j < size_; ++j) {
-                std::cout << matrix_[i][j] << " ";
+                std::cout << rows_[i][j] << " ";
             }
             std::cout <<std::endl;
         }
@@ -85,14 +171,55 @@ public:
         return size_;
     };
 
+    /**
+     * Getter pre dĺžku riadku v pamäti (počet prvkov vrátane doplnenia na zarovnanie).
+     *
+     * @return dĺžka riadku v pamäti
+     */
+    int getStride() {
+        return stride_;
+    };
+
+    /**
+     * Getter pre tabuľku riadkov (ukazovateľov na riadky v logickom poradí).
+     *
+     * @return ukazovateľ na tabuľku riadkov
+     */
+    T** getRows() {
+        return rows_;
+    };
+
     /**
      * Operátor [] slúži na prístup k jednotlivým prvkom matice.
+     * Vracia referenciu na ukazovateľ v tabuľke riadkov, takže výmena riadkov cez std::swap mení iba ich logické poradie.
      *
      * @param index index riadku matice
      * @return referenciu na pointer (riadok matice)
      */
     T*& operator[](int index) {
-        return matrix_[index];
+        return rows_[index];
+    }
+
+private:
+    /**
+     * Metóda resetRowOrder nastaví tabuľku riadkov na fyzické poradie riadkov v pamäti.
+     * Mení logický obsah matice, ak boli riadky predtým vymenené.
+     */
+    void resetRowOrder() {
+        for (int i = 0; i < size_; ++i) {
+            rows_[i] = data_ + static_cast<std::size_t>(i) * stride_;
+        }
+    }
+
+    /**
+     * Metóda release odovzdá vlastníctvo pamäte (po presune) a nastaví maticu na prázdnu.
+     */
+    void release() {
+        size_ = 0;
+        stride_ = 0;
+        memory_ = nullptr;
+        rows_ = nullptr;
+        data_ = nullptr;
     }
 };
 
@@ -0,0 +1,60 @@
+#ifndef BAKALARSKAPRACA_MATRIXPOOL_H
+#define BAKALARSKAPRACA_MATRIXPOOL_H
+
+#include <unordered_map>
+#include <utility>
+#include <vector>
+#include "Matrix.h"
+
+/**
+ * Trieda MatrixPool uchováva nepoužívané matice rozdelené podľa stupňa, aby sa ich pamäť dala znovu použiť.
+ * Matica získaná z poolu má nešpecifikovaný obsah a je potrebné ju celú prepísať (napr. metódou generateValues).
+ *
+ * @tparam T dátový typ prvkov matíc
+ */
+template<class T>
+class MatrixPool {
+private:
+    std::unordered_map<int, std::vector<Matrix<T>>> freeMatrices_;     // voľné matice podľa stupňa
+public:
+    /**
+     * Default konštruktor triedy.
+     */
+    MatrixPool() {};
+
+    /**
+     * Metóda acquire vráti maticu zadaného stupňa.
+     * Ak je v poole voľná matica daného stupňa, použije jej pamäť, inak alokuje novú maticu bez nulovania prvkov.
+     *
+     * @param size stupeň (veľkosť) štvorcovej matice
+     * @return matica s nešpecifikovaným obsahom
+     */
+    Matrix<T> acquire(int size) {
+        auto found = freeMatrices_.find(size);
+        if (found != freeMatrices_.end() && !found->second.empty()) {
+            Matrix<T> matrix = std::move(found->second.back());
+            found->second.pop_back();
+            return matrix;
+        }
+        return Matrix<T>(size, false);
+    }
+
+    /**
+     * Metóda release vráti maticu do poolu na neskoršie použitie.
+     *
+     * @param matrix matica, ktorej pamäť sa má znovu použiť
+     */
+    void release(Matrix<T>&& matrix) {
+        int size = matrix.getSize();
+        freeMatrices_[size].push_back(std::move(matrix));
+    }
+
+    /**
+     * Metóda clear uvoľní všetky matice v poole.
+     */
+    void clear() {
+        freeMatrices_.clear();
+    }
+};
+
+#endif
@@ -0,0 +1,78 @@
+#ifndef BAKALARSKAPRACA_MATRIXVIEW_H
+#define BAKALARSKAPRACA_MATRIXVIEW_H
+
+#include "Matrix.h"
+
+/**
+ * Trieda MatrixView reprezentuje pohľad na štvorcovú podmaticu (minor) rodičovskej matice.
+ * Neukladá vlastné prvky, iba ukazovateľ na tabuľku riadkov rodičovskej matice
+ * a zoznamy aktívnych riadkov a stĺpcov, takže vytvorenie minoru nealokuje ani nekopíruje prvky.
+ *
+ * @tparam T dátový typ prvkov matice
+ */
+template<class T>
+class MatrixView {
+private:
+    T** rows_;                  // tabuľka riadkov rodičovskej matice
+    const int* rowIndices_;     // indexy aktívnych riadkov rodičovskej matice
+    const int* columnIndices_;  // indexy aktívnych stĺpcov rodičovskej matice
+    int size_;                  // stupeň (veľkosť) podmatice
+public:
+    /**
+     * Konštruktor pre pohľad na podmaticu.
+     *
+     * @param rows tabuľka riadkov rodičovskej matice
+     * @param rowIndices indexy aktívnych riadkov (vzostupne)
+     * @param columnIndices indexy aktívnych stĺpcov (vzostupne)
+     * @param size stupeň (veľkosť) podmatice
+     */
+    MatrixView(T** rows, const int* rowIndices, const int* columnIndices, int size)
+        : rows_(rows), rowIndices_(rowIndices), columnIndices_(columnIndices), size_(size) {};
+
+    /**
+     * Metóda minor vytvorí pohľad na podmaticu bez zadaného riadku a stĺpca.
+     * Zoznamy indexov novej podmatice zapíše do poskytnutej pamäte (aspoň 2 * (size - 1) prvkov).
+     *
+     * @param row index vynechaného riadku v rámci tejto podmatice
+     * @param column index vynechaného stĺpca v rámci tejto podmatice
+     * @param indexBuffer pamäť pre zoznamy indexov novej podmatice
+     * @return pohľad na podmaticu o jeden stupeň menšiu
+     */
+    MatrixView minor(int row, int column, int* indexBuffer) const {
+        int* newRowIndices = indexBuffer;
+        int* newColumnIndices = indexBuffer + (size_ - 1);
+        for (int i = 0, k = 0; i < size_; ++i) {
+            if (i != row) {
+                newRowIndices[k++] = rowIndices_[i];
+            }
+        }
+        for (int j = 0, k = 0; j < size_; ++j) {
+            if (j != column) {
+                newColumnIndices[k++] = columnIndices_[j];
+            }
+        }
+        return MatrixView(rows_, newRowIndices, newColumnIndices, size_ - 1);
+    }
+
+    /**
+     * Getter pre stupeň (veľkosť) podmatice.
+     *
+     * @return stupeň (veľkosť) podmatice
+     */
+    int getSize() const {
+        return size_;
+    };
+
+    /**
+     * Operátor () slúži na prístup k prvkom podmatice.
+     *
+     * @param row index riadku v rámci podmatice
+     * @param column index stĺpca v rámci podmatice
+     * @return hodnota prvku
+     */
+    T operator()(int row, int column) const {
+        return rows_[rowIndices_[row]][columnIndices_[column]];
+    }
+};
+
+#endif
@@ -0,0 +1,180 @@
+#ifndef BAKALARSKAPRACA_MODULAR_H
+#define BAKALARSKAPRACA_MODULAR_H
+
+#include <cstdint>
+#include <initializer_list>
+
+/**
+ * Trieda MontgomeryField predstavuje aritmetiku modulo prvočíslo p < 2^31 v Montgomeryho tvare.
+ * Číslo a je uložené ako a * 2^32 mod p, takže násobenie nepotrebuje delenie, iba dve násobenia a posun (redukcia REDC).
+ */
+class MontgomeryField {
+private:
+    std::uint32_t prime_;               // prvočíslo p
+    std::uint32_t negatedInverse_;      // -p^(-1) mod 2^32
+    std::uint32_t rSquared_;            // 2^64 mod p (prevod do Montgomeryho tvaru)
+public:
+    /**
+     * Konštruktor pre prvočíslo.
+     *
+     * @param prime nepárne prvočíslo menšie ako 2^31
+     */
+    explicit MontgomeryField(std::uint32_t prime) : prime_(prime) {
+        // inverzia modulo 2^32 Newtonovou metódou (každá iterácia zdvojnásobí počet platných bitov)
+        std::uint32_t inverse = prime;
+        for (int i = 0; i < 4; ++i) {
+            inverse *= 2 - prime * inverse;
+        }
+        negatedInverse_ = 0 - inverse;
+        std::uint64_t r = (static_cast<std::uint64_t>(1) << 32) % prime;
+        rSquared_ = static_cast<std::uint32_t>(r * r % prime);
+    }
+
+    /**
+     * Getter pre prvočíslo.
+     *
+     * @return prvočíslo p
+     */
+    std::uint32_t getPrime() const {
+        return prime_;
+    }
+
+    /**
+     * Getter pre -p^(-1) mod 2^32.
+     *
+     * @return záporná inverzia prvočísla modulo 2^32
+     */
+    std::uint32_t getNegatedInverse() const {
+        return negatedInverse_;
+    }
+
+    /**
+     * Metóda reduce vypočíta value * 2^(-32) mod p (redukcia REDC).
+     *
+     * @param value číslo menšie ako p * 2^32
+     * @return výsledok z intervalu [0, p)
+     */
+    std::uint32_t reduce(std::uint64_t value) const {
+        std::uint32_t m = static_cast<std::uint32_t>(value) * negatedInverse_;
+        std::uint32_t result = static_cast<std::uint32_t>((value + static_cast<std::uint64_t>(m) * prime_) >> 32);
+        return result >= prime_ ? result - prime_ : result;
+    }
+
+    /**
+     * Metóda toMontgomery prevedie zvyšok do Montgomeryho tvaru.
+     *
+     * @param value zvyšok z intervalu [0, p)
+     * @return číslo v Montgomeryho tvare
+     */
+    std::uint32_t toMontgomery(std::uint32_t value) const {
+        return multiply(value, rSquared_);
+    }
+
+    /**
+     * Metóda fromMontgomery prevedie číslo z Montgomeryho tvaru na zvyšok.
+     *
+     * @param value číslo v Montgomeryho tvare
+     * @return zvyšok z intervalu [0, p)
+     */
+    std::uint32_t fromMontgomery(std::uint32_t value) const {
+        return reduce(value);
+    }
+
+    /**
+     * Metóda multiply vynásobí dve čísla v Montgomeryho tvare.
+     *
+     * @return súčin v Montgomeryho tvare
+     */
+    std::uint32_t multiply(std::uint32_t first, std::uint32_t second) const {
+        return reduce(static_cast<std::uint64_t>(first) * second);
+    }
+
+    /**
+     * Metóda power umocní číslo v Montgomeryho tvare.
+     *
+     * @param base základ v Montgomeryho tvare
+     * @param exponent exponent
+     * @return mocnina v Montgomeryho tvare
+     */
+    std::uint32_t power(std::uint32_t base, std::uint32_t exponent) const {
+        std::uint32_t result = toMontgomery(1);
+        while (exponent != 0) {
+            if (exponent & 1) {
+                result = multiply(result, base);
+            }
+            base = multiply(base, base);
+            exponent >>= 1;
+        }
+        return result;
+    }
+
+    /**
+     * Metóda inverse vypočíta inverzný prvok podľa malej Fermatovej vety (a^(p-2)).
+     *
+     * @param value nenulové číslo v Montgomeryho tvare
+     * @return inverzný prvok v Montgomeryho tvare
+     */
+    std::uint32_t inverse(std::uint32_t value) const {
+        return power(value, prime_ - 2);
+    }
+
+    /**
+     * Metóda isPrime deterministicky overí prvočíselnosť 32-bitového čísla (Millerov-Rabinov test so základmi 2, 7 a 61).
+     *
+     * @param number testované číslo
+     * @return či je číslo prvočíslo (boolean)
+     */
+    static bool isPrime(std::uint32_t number) {
+        if (number < 2) {
+            return false;
+        }
+        for (std::uint32_t small : { 2u, 3u, 5u, 7u, 61u }) {
+            if (number % small == 0) {
+                return number == small;
+            }
+        }
+        std::uint32_t odd = number - 1;
+        int twos = 0;
+        while ((odd & 1) == 0) {
+            odd >>= 1;
+            twos++;
+        }
+        for (std::uint64_t base : { 2u, 7u, 61u }) {
+            std::uint64_t x = 1;
+            for (std::uint32_t exponent = odd; exponent != 0; exponent >>= 1) {
+                if (exponent & 1) {
+                    x = x * base % number;
+                }
+                base = base * base % number;
+            }
+            if (x == 1 || x == number - 1) {
+                continue;
+            }
+            bool composite = true;
+            for (int i = 1; i < twos && composite; ++i) {
+                x = x * x % number;
+                composite = x != number - 1;
+            }
+            if (composite) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /**
+     * Metóda previousPrime nájde najväčšie prvočíslo menšie ako zadané číslo.
+     *
+     * @param bound horná hranica (vylúčená)
+     * @return prvočíslo
+     */
+    static std::uint32_t previousPrime(std::uint32_t bound) {
+        std::uint32_t candidate = bound - 1;
+        while (!isPrime(candidate)) {
+            candidate--;
+        }
+        return candidate;
+    }
+};
+
+#endif
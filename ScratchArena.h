@@ -0,0 +1,329 @@
+#ifndef BAKALARSKAPRACA_SCRATCHARENA_H
+#define BAKALARSKAPRACA_SCRATCHARENA_H
+
+#include <algorithm>
+#include <cstddef>
+#include <new>
+#include <vector>
+
+/**
+ * Trieda ScratchArena predstavuje lineárny (bump) alokátor pomocnej pamäte pre výpočtové algoritmy.
+ * Alokácia iba posúva ukazovateľ v už alokovanom bloku, uvoľnenie prebieha naraz pomocou reset alebo release.
+ * Ak sa požiadavka nezmestí, arena pridá ďalší blok a pri najbližšom resete bloky zlúči do jedného,
+ * takže opakované výpočty rovnakej veľkosti (replikácie) už nealokujú žiadnu pamäť na halde.
+ */
+class ScratchArena {
+public:
+    static constexpr std::size_t ALIGNMENT = 64;            // zarovnanie alokácií v bajtoch (veľkosť cache line)
+    static constexpr std::size_t MIN_BLOCK_SIZE = 1 << 16;  // minimálna veľkosť bloku v bajtoch
+
+    /**
+     * Štruktúra Marker uchováva stav areny, ku ktorému je možné sa vrátiť pomocou release.
+     */
+    struct Marker {
+        std::size_t blockIndex;     // index aktuálneho bloku
+        std::size_t offset;         // obsadenosť aktuálneho bloku
+        std::size_t usedBytes;      // celkový počet obsadených bajtov
+    };
+
+private:
+    /**
+     * Štruktúra Block reprezentuje jeden súvislý blok pamäte areny.
+     */
+    struct Block {
+        char* memory;               // začiatok bloku
+        std::size_t capacity;       // veľkosť bloku v bajtoch
+    };
+
+    std::vector<Block> blocks_;     // bloky pamäte
+    std::size_t blockIndex_;        // index aktuálneho bloku
+    std::size_t offset_;            // obsadenosť aktuálneho bloku v bajtoch
+    std::size_t usedBytes_;         // celkový počet obsadených bajtov
+    std::size_t peakBytes_;         // najväčší počet obsadených bajtov od posledného resetu
+public:
+    /**
+     * Default konštruktor areny. Pamäť sa alokuje až pri prvej požiadavke.
+     */
+    ScratchArena() : blockIndex_(0), offset_(0), usedBytes_(0), peakBytes_(0) {};
+
+    ScratchArena(const ScratchArena&) = delete;
+    ScratchArena& operator=(const ScratchArena&) = delete;
+
+    /**
+     * Deštruktor areny. Uvoľní všetky bloky pamäte.
+     */
+    ~ScratchArena() {
+        releaseBlocks();
+    }
+
+    /**
+     * Metóda local vráti arenu patriacu aktuálnemu vláknu.
+     *
+     * @return referencia na arenu aktuálneho vlákna
+     */
+    static ScratchArena& local() {
+        thread_local ScratchArena arena;
+        return arena;
+    }
+
+    /**
+     * Metóda allocate vyhradí neinicializovanú pamäť pre zadaný počet prvkov.
+     *
+     * @tparam T dátový typ prvkov (musí byť triviálne kopírovateľný)
+     * @param count počet prvkov
+     * @return ukazovateľ na zarovnanú pamäť
+     */
+    template<typename T>
+    T* allocate(std::size_t count) {
+        std::size_t bytes = (count * sizeof(T) + ALIGNMENT - 1) / ALIGNMENT * ALIGNMENT;
+        // nájdenie bloku, do ktorého sa požiadavka zmestí
+        while (blockIndex_ < blocks_.size() && offset_ + bytes > blocks_[blockIndex_].capacity) {
+            blockIndex_++;
+            offset_ = 0;
+        }
+        if (blockIndex_ == blocks_.size()) {
+            std::size_t capacity = std::max({ bytes, MIN_BLOCK_SIZE, blocks_.empty() ? 0 : 2 * blocks_.back().capacity });
+            blocks_.push_back({ static_cast<char*>(::operator new(capacity, std::align_val_t(ALIGNMENT))), capacity });
+        }
+        T* result = reinterpret_cast<T*>(blocks_[blockIndex_].memory + offset_);
+        offset_ += bytes;
+        usedBytes_ += bytes;
+        peakBytes_ = std::max(peakBytes_, usedBytes_);
+        return result;
+    }
+
+    /**
+     * Metóda mark vráti aktuálny stav areny.
+     *
+     * @return stav areny
+     */
+    Marker mark() const {
+        return { blockIndex_, offset_, usedBytes_ };
+    }
+
+    /**
+     * Metóda release uvoľní všetky alokácie vykonané po vytvorení zadaného stavu.
+     *
+     * @param marker stav areny získaný metódou mark
+     */
+    void release(const Marker& marker) {
+        blockIndex_ = marker.blockIndex;
+        offset_ = marker.offset;
+        usedBytes_ = marker.usedBytes;
+    }
+
+    /**
+     * Metóda reset uvoľní všetky alokácie a vynuluje maximum obsadenej pamäte.
+     * Ak arena počas výpočtu potrebovala viac blokov, zlúči ich do jedného bloku.
+     */
+    void reset() {
+        if (blocks_.size() > 1) {
+            std::size_t capacity = 0;
+            for (const Block& block : blocks_) {
+                capacity += block.capacity;
+            }
+            releaseBlocks();
+            blocks_.push_back({ static_cast<char*>(::operator new(capacity, std::align_val_t(ALIGNMENT))), capacity });
+        }
+        blockIndex_ = 0;
+        offset_ = 0;
+        usedBytes_ = 0;
+        peakBytes_ = 0;
+    }
+
+    /**
+     * Getter pre najväčší počet obsadených bajtov od posledného resetu.
+     *
+     * @return maximum obsadenej pamäte v bajtoch
+     */
+    std::size_t getPeakBytes() const {
+        return peakBytes_;
+    }
+
+    /**
+     * Metóda restartPeak nastaví maximum obsadenej pamäte na aktuálnu obsadenosť (maximum sa bude merať od tohto bodu).
+     *
+     * @return doterajšie maximum obsadenej pamäte v bajtoch
+     */
+    std::size_t restartPeak() {
+        std::size_t peak = peakBytes_;
+        peakBytes_ = usedBytes_;
+        return peak;
+    }
+
+    /**
+     * Metóda mergePeak započíta do maxima obsadenej pamäte maximum vrátené metódou restartPeak.
+     *
+     * @param peak maximum obsadenej pamäte v bajtoch
+     */
+    void mergePeak(std::size_t peak) {
+        peakBytes_ = std::max(peakBytes_, peak);
+    }
+
+private:
+    /**
+     * Metóda releaseBlocks uvoľní všetky bloky pamäte.
+     */
+    void releaseBlocks() {
+        for (const Block& block : blocks_) {
+            ::operator delete(block.memory, std::align_val_t(ALIGNMENT));
+        }
+        blocks_.clear();
+    }
+};
+
+/**
+ * Trieda ScratchScope pri zániku vráti arenu do stavu, v akom bola pri jej vytvorení. Počas existencie meria
+ * maximum pamäte alokovanej v rámci rozsahu (napr. pre úlohy pomocných vlákien, ktorých arena sa neresetuje).
+ */
+class ScratchScope {
+private:
+    ScratchArena& arena_;           // arena
+    ScratchArena::Marker marker_;   // stav areny pri vytvorení
+    std::size_t outerPeakBytes_;    // maximum obsadenej pamäte areny pred vytvorením
+public:
+    /**
+     * Konštruktor zapamätá aktuálny stav areny.
+     *
+     * @param arena referencia na arenu
+     */
+    explicit ScratchScope(ScratchArena& arena) : arena_(arena), marker_(arena.mark()), outerPeakBytes_(arena.restartPeak()) {};
+
+    ScratchScope(const ScratchScope&) = delete;
+    ScratchScope& operator=(const ScratchScope&) = delete;
+
+    /**
+     * Deštruktor uvoľní alokácie vykonané počas existencie objektu.
+     */
+    ~ScratchScope() {
+        arena_.release(marker_);
+        arena_.mergePeak(outerPeakBytes_);
+    }
+
+    /**
+     * Getter pre maximum pamäte alokovanej od vytvorenia objektu.
+     *
+     * @return maximum pamäte v bajtoch
+     */
+    std::size_t getPeakBytes() const {
+        return arena_.getPeakBytes() - marker_.usedBytes;
+    }
+};
+
+/**
+ * Trieda ScratchList predstavuje rastúci zoznam prvkov v pamäti areny. Ak sa prvok nezmestí, zoznam sa presunie
+ * do dvojnásobne veľkej pamäte areny (pôvodná pamäť sa uvoľní až resetom areny), na halde sa preto nealokuje nič.
+ * Objekt je triviálne kopírovateľný, takže aj pole zoznamov môže ležať v arene.
+ *
+ * @tparam T dátový typ prvkov (musí byť triviálne kopírovateľný)
+ */
+template<typename T>
+class ScratchList {
+private:
+    T* data_;           // prvky zoznamu
+    int size_;          // počet prvkov
+    int capacity_;      // počet prvkov, pre ktoré je vyhradená pamäť
+public:
+    /**
+     * Konštruktor pre prázdny zoznam s vyhradenou pamäťou.
+     *
+     * @param arena referencia na arenu
+     * @param capacity počet prvkov, pre ktoré sa vyhradí pamäť
+     */
+    ScratchList(ScratchArena& arena, int capacity) : data_(arena.allocate<T>(std::max(capacity, 1))), size_(0), capacity_(std::max(capacity, 1)) {};
+
+    /**
+     * Metóda pushBack pridá prvok na koniec zoznamu.
+     *
+     * @param element prvok
+     * @param arena referencia na arenu, z ktorej sa zoznam vytvoril
+     */
+    void pushBack(const T& element, ScratchArena& arena) {
+        if (size_ == capacity_) {
+            T* data = arena.allocate<T>(2 * static_cast<std::size_t>(capacity_));
+            std::copy(data_, data_ + size_, data);
+            data_ = data;
+            capacity_ *= 2;
+        }
+        data_[size_++] = element;
+    }
+
+    /**
+     * Metóda popBack odstráni posledný prvok zoznamu.
+     */
+    void popBack() {
+        size_--;
+    }
+
+    /**
+     * Metóda resize skráti zoznam na zadaný počet prvkov.
+     *
+     * @param size nový počet prvkov (najviac aktuálny počet)
+     */
+    void resize(int size) {
+        size_ = size;
+    }
+
+    /**
+     * Metóda clear odstráni všetky prvky zoznamu (pamäť ostane vyhradená).
+     */
+    void clear() {
+        size_ = 0;
+    }
+
+    /**
+     * Getter pre počet prvkov.
+     *
+     * @return počet prvkov
+     */
+    int size() const {
+        return size_;
+    }
+
+    /**
+     * Metóda back vráti posledný prvok zoznamu.
+     *
+     * @return referencia na posledný prvok
+     */
+    T& back() {
+        return data_[size_ - 1];
+    }
+
+    /**
+     * Metóda begin vráti ukazovateľ na prvý prvok (pre prechod cyklom for).
+     *
+     * @return ukazovateľ na prvý prvok
+     */
+    T* begin() {
+        return data_;
+    }
+
+    /**
+     * Metóda end vráti ukazovateľ za posledný prvok.
+     *
+     * @return ukazovateľ za posledný prvok
+     */
+    T* end() {
+        return data_ + size_;
+    }
+
+    /**
+     * Metóda begin vráti ukazovateľ na prvý prvok (pre prechod cyklom for).
+     *
+     * @return ukazovateľ na prvý prvok
+     */
+    const T* begin() const {
+        return data_;
+    }
+
+    /**
+     * Metóda end vráti ukazovateľ za posledný prvok.
+     *
+     * @return ukazovateľ za posledný prvok
+     */
+    const T* end() const {
+        return data_ + size_;
+    }
+};
+
+#endif
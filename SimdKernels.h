@@ -0,0 +1,847 @@
+#ifndef BAKALARSKAPRACA_SIMDKERNELS_H
+#define BAKALARSKAPRACA_SIMDKERNELS_H
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <utility>
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+#define BAKALARSKAPRACA_X86 1
+#include <immintrin.h>
+// SSE2 nemá inštrukciu FMA, násobenie so sčítaním je preto rozdelené na dve inštrukcie
+#define BAKALARSKAPRACA_MULADD_PD(a, b, c) _mm_add_pd(_mm_mul_pd(a, b), c)
+#define BAKALARSKAPRACA_MULADD_PS(a, b, c) _mm_add_ps(_mm_mul_ps(a, b), c)
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#endif
+#endif
+
+// GCC a Clang potrebujú pri funkciách s inštrukciami vyššej sady explicitný cieľ, MSVC povoľuje intrinsics vždy
+#if defined(__GNUC__) || defined(__clang__)
+#define BAKALARSKAPRACA_TARGET(isa) __attribute__((target(isa)))
+#else
+#define BAKALARSKAPRACA_TARGET(isa)
+#endif
+
+/**
+ * Enum simdLevel, ktorý reprezentuje najvyššiu podporovanú sadu vektorových inštrukcií procesora.
+ */
+enum simdLevel { SIMD_SCALAR, SIMD_SSE2, SIMD_AVX2, SIMD_AVX512 };
+
+/**
+ * Trieda SimdKernels obsahuje ručne vektorizované výpočtové jadrá a ich výber podľa schopností procesora.
+ * Sada inštrukcií sa zistí pomocou CPUID raz pri prvom použití, jadrá pre vyššie sady sa volajú iba ak ich procesor podporuje.
+ */
+class SimdKernels {
+public:
+    /**
+     * Typ ukazovateľa na jadro úpravy riadku: target[k] += source[k] * factor a hodnoty v intervale (-delta, delta) nastaví na 0.
+     *
+     * @tparam T dátový typ prvkov
+     */
+    template<typename T>
+    using RowUpdateKernel = void (*)(T* target, const T* source, T factor, T delta, int count);
+
+    /**
+     * Typ ukazovateľa na jadro modulárnej úpravy riadku: target[k] = target[k] - source[k] * factor mod prime,
+     * kde všetky čísla sú zvyšky v Montgomeryho tvare (prime < 2^31, negatedInverse = -prime^(-1) mod 2^32).
+     */
+    using ModularRowUpdateKernel = void (*)(std::uint32_t* target, const std::uint32_t* source, std::uint32_t factor, std::uint32_t prime, std::uint32_t negatedInverse, int count);
+
+    /**
+     * Typ ukazovateľa na jadro dávkového výpočtu determinantov malých matíc uložených po zložkách (structure of arrays):
+     * prvok (i, j) matice m je na indexe (i * size + j) * stride + m, takže rovnaký prvok susedných matíc leží vedľa seba
+     * a jeden vektorový register obsahuje prvok (i, j) niekoľkých matíc naraz.
+     *
+     * @tparam T dátový typ prvkov
+     */
+    template<typename T>
+    using BatchDeterminantKernel = void (*)(const T* elements, std::size_t stride, T* determinants, std::size_t count, int size);
+
+    static constexpr int TILE_ROWS = 4;     // počet riadkov dlaždice jadra úpravy dlaždice
+    static constexpr int BATCH_MAX_SIZE = 4;    // najväčší stupeň matíc, ktoré spracuje jadro dávkového výpočtu determinantov
+
+    /**
+     * Štruktúra TileUpdateKernel opisuje jadro úpravy dlaždice TILE_ROWS x columns podmatice pri blokovom rozklade:
+     * rows[row + r][column + c] -= sum_p rows[row + r][p] * rows[p][column + c] pre p z intervalu [panelStart, panelEnd).
+     *
+     * @tparam T dátový typ prvkov
+     */
+    template<typename T>
+    struct TileUpdateKernel {
+        void (*update)(T** rows, int row, int panelStart, int panelEnd, int column);    // jadro
+        int columns;                                                                   // počet stĺpcov dlaždice
+    };
+
+    /**
+     * Štruktúra BatchLuKernel opisuje jadro LU rozkladu skupiny lanes prekladaných matíc rovnakého stupňa:
+     * prvok (i, j) matice l je v skupine na indexe (i * size + j) * lanes + l, každá zložka vektora teda rozkladá inú maticu.
+     * Jadro prepíše skupinu a zapíše lanes determinantov.
+     *
+     * @tparam T dátový typ prvkov
+     */
+    template<typename T>
+    struct BatchLuKernel {
+        void (*factor)(T* group, T* determinants, int size);   // jadro
+        int lanes;                                              // počet matíc v skupine
+    };
+
+    /**
+     * Metóda getSimdLevel vráti najvyššiu sadu vektorových inštrukcií podporovanú procesorom a operačným systémom.
+     *
+     * @return podporovaná sada inštrukcií
+     */
+    static simdLevel getSimdLevel() {
+        static const simdLevel level = detectSimdLevel();
+        return level;
+    }
+
+    /**
+     * Metóda getSimdLevelName vráti názov sady inštrukcií, ktorú používajú vybrané jadrá.
+     *
+     * @return názov sady inštrukcií
+     */
+    static std::string getSimdLevelName() {
+        switch (getSimdLevel()) {
+            case SIMD_AVX512: return "AVX-512";
+            case SIMD_AVX2: return "AVX2";
+            case SIMD_SSE2: return "SSE2";
+            default: return "Scalar";
+        }
+    }
+
+    /**
+     * Metóda rowUpdateKernel vráti jadro úpravy riadku pre daný dátový typ.
+     * Pre float a double vyberie vektorizované jadro podľa procesora, pre ostatné typy skalárne jadro.
+     *
+     * @tparam T dátový typ prvkov
+     * @return ukazovateľ na jadro úpravy riadku
+     */
+    template<typename T>
+    static RowUpdateKernel<T> rowUpdateKernel() {
+        return &rowUpdateScalar<T>;
+    }
+
+    /**
+     * Metóda tileUpdateKernel vráti jadro úpravy dlaždice pre daný dátový typ.
+     * Pre float a double vyberie vektorizované jadro podľa procesora, pre ostatné typy skalárne jadro.
+     *
+     * @tparam T dátový typ prvkov
+     * @return jadro úpravy dlaždice a počet jeho stĺpcov
+     */
+    template<typename T>
+    static TileUpdateKernel<T> tileUpdateKernel() {
+        return { &tileUpdateScalar<T>, SCALAR_TILE_COLUMNS };
+    }
+
+    /**
+     * Metóda batchDeterminantKernel vráti jadro dávkového výpočtu determinantov pre daný dátový typ.
+     * Pre float a double vyberie vektorizované jadro podľa procesora, pre ostatné typy skalárne jadro.
+     *
+     * @tparam T dátový typ prvkov
+     * @return ukazovateľ na jadro dávkového výpočtu determinantov
+     */
+    template<typename T>
+    static BatchDeterminantKernel<T> batchDeterminantKernel() {
+        return &batchDeterminantScalar<T>;
+    }
+
+    /**
+     * Metóda batchLuKernel vráti jadro LU rozkladu prekladaných matíc pre daný dátový typ.
+     * Pre float a double vyberie vektorizované jadro podľa procesora (AVX2 alebo AVX-512), inak skalárne jadro s jednou maticou v skupine.
+     *
+     * @tparam T dátový typ prvkov
+     * @return jadro LU rozkladu a počet matíc v skupine
+     */
+    template<typename T>
+    static BatchLuKernel<T> batchLuKernel() {
+        return { &batchLuScalar<T>, 1 };
+    }
+
+    /**
+     * Metóda modularRowUpdateKernel vráti jadro modulárnej úpravy riadku vybrané podľa procesora.
+     *
+     * @return ukazovateľ na jadro modulárnej úpravy riadku
+     */
+    static ModularRowUpdateKernel modularRowUpdateKernel() {
+#ifdef BAKALARSKAPRACA_X86
+        static const ModularRowUpdateKernel kernel = selectModularRowUpdateKernel();
+        return kernel;
+#else
+        return &modularRowUpdateScalar;
+#endif
+    }
+
+private:
+    static constexpr int SCALAR_TILE_COLUMNS = 8;   // počet stĺpcov dlaždice skalárneho jadra
+
+    /**
+     * Metóda detectSimdLevel zistí pomocou CPUID podporovanú sadu vektorových inštrukcií.
+     *
+     * @return podporovaná sada inštrukcií
+     */
+    static simdLevel detectSimdLevel() {
+#if defined(BAKALARSKAPRACA_X86) && (defined(__GNUC__) || defined(__clang__))
+        __builtin_cpu_init();
+        if (__builtin_cpu_supports("avx512f")) {
+            return SIMD_AVX512;
+        }
+        if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma")) {
+            return SIMD_AVX2;
+        }
+        if (__builtin_cpu_supports("sse2")) {
+            return SIMD_SSE2;
+        }
+        return SIMD_SCALAR;
+#elif defined(BAKALARSKAPRACA_X86) && defined(_MSC_VER)
+        int info[4];
+        __cpuid(info, 0);
+        int maxLeaf = info[0];
+        __cpuid(info, 1);
+        bool sse2 = (info[3] & (1 << 26)) != 0;
+        bool osxsave = (info[2] & (1 << 27)) != 0;
+        bool avx = (info[2] & (1 << 28)) != 0;
+        bool fma = (info[2] & (1 << 12)) != 0;
+        unsigned long long xcr0 = osxsave ? _xgetbv(0) : 0;
+        // operačný systém musí ukladať registre YMM (bity 1, 2) a pre AVX-512 aj registre ZMM a masky (bity 5, 6, 7)
+        bool ymmState = (xcr0 & 0x6) == 0x6;
+        bool zmmState = (xcr0 & 0xE6) == 0xE6;
+        bool avx2 = false;
+        bool avx512 = false;
+        if (maxLeaf >= 7) {
+            __cpuidex(info, 7, 0);
+            avx2 = (info[1] & (1 << 5)) != 0;
+            avx512 = (info[1] & (1 << 16)) != 0;
+        }
+        if (avx && avx512 && zmmState) {
+            return SIMD_AVX512;
+        }
+        if (avx && avx2 && fma && ymmState) {
+            return SIMD_AVX2;
+        }
+        return sse2 ? SIMD_SSE2 : SIMD_SCALAR;
+#else
+        return SIMD_SCALAR;
+#endif
+    }
+
+    /**
+     * Metóda rowUpdateScalar predstavuje skalárne jadro úpravy riadku.
+     *
+     * @tparam T dátový typ prvkov
+     * @param target upravovaný riadok
+     * @param source riadok pivota
+     * @param factor násobok riadku pivota
+     * @param delta hranica, pod ktorou sa hodnoty považujú za 0
+     * @param count počet prvkov
+     */
+    template<typename T>
+    static void rowUpdateScalar(T* target, const T* source, T factor, T delta, int count) {
+        for (int k = 0; k < count; ++k) {
+            target[k] += source[k] * factor;
+            // nastavenie malých hodnôt blízkych nule na 0
+            if (target[k] < delta && target[k] > -delta) {
+                target[k] = 0;
+            }
+        }
+    }
+
+    /**
+     * Metóda tileUpdateScalar predstavuje skalárne jadro úpravy dlaždice TILE_ROWS x SCALAR_TILE_COLUMNS.
+     *
+     * @tparam T dátový typ prvkov
+     * @param rows tabuľka riadkov matice
+     * @param row prvý riadok dlaždice
+     * @param panelStart prvý stĺpec panelu
+     * @param panelEnd stĺpec za posledným stĺpcom panelu
+     * @param column prvý stĺpec dlaždice
+     */
+    template<typename T>
+    static void tileUpdateScalar(T** rows, int row, int panelStart, int panelEnd, int column) {
+        T accumulator[TILE_ROWS][SCALAR_TILE_COLUMNS] = {};
+        for (int p = panelStart; p < panelEnd; ++p) {
+            const T* source = rows[p] + column;
+            for (int r = 0; r < TILE_ROWS; ++r) {
+                T multiplier = rows[row + r][p];
+                for (int c = 0; c < SCALAR_TILE_COLUMNS; ++c) {
+                    accumulator[r][c] += multiplier * source[c];
+                }
+            }
+        }
+        for (int r = 0; r < TILE_ROWS; ++r) {
+            T* target = rows[row + r] + column;
+            for (int c = 0; c < SCALAR_TILE_COLUMNS; ++c) {
+                target[c] -= accumulator[r][c];
+            }
+        }
+    }
+
+    /**
+     * Metóda batchDeterminantScalar predstavuje skalárne jadro dávkového výpočtu determinantov matíc stupňa 1 až BATCH_MAX_SIZE.
+     * Matice stupňa 3 sa počítajú Sarusovým pravidlom, stupňa 4 rozvojom podľa prvého riadku, v ktorom sa minory stupňa 3
+     * skladajú zo šiestich spoločných minorov stupňa 2 posledných dvoch riadkov. Poradie operácií je rovnaké ako vo vektorových jadrách.
+     *
+     * @tparam T dátový typ prvkov
+     * @param elements prvky matíc po zložkách
+     * @param stride vzdialenosť rovnakého prvku v pamäti pre susedné zložky (počet matíc v poli)
+     * @param determinants výstupné pole determinantov
+     * @param count počet matíc
+     * @param size stupeň matíc
+     */
+    template<typename T>
+    static void batchDeterminantScalar(const T* elements, std::size_t stride, T* determinants, std::size_t count, int size) {
+        for (std::size_t m = 0; m < count; ++m) {
+            T a[BATCH_MAX_SIZE * BATCH_MAX_SIZE];
+            for (int e = 0; e < size * size; ++e) {
+                a[e] = elements[e * stride + m];
+            }
+            switch (size) {
+                case 1: determinants[m] = a[0]; break;
+                case 2: determinants[m] = a[0] * a[3] - a[1] * a[2]; break;
+                case 3:
+                    determinants[m] = a[0] * a[4] * a[8] + a[1] * a[5] * a[6] + a[2] * a[3] * a[7]
+                                      - a[2] * a[4] * a[6] - a[0] * a[5] * a[7] - a[1] * a[3] * a[8];
+                    break;
+                default: {
+                    T s0 = a[8] * a[13] - a[9] * a[12];
+                    T s1 = a[8] * a[14] - a[10] * a[12];
+                    T s2 = a[8] * a[15] - a[11] * a[12];
+                    T s3 = a[9] * a[14] - a[10] * a[13];
+                    T s4 = a[9] * a[15] - a[11] * a[13];
+                    T s5 = a[10] * a[15] - a[11] * a[14];
+                    T c0 = a[5] * s5 - a[6] * s4 + a[7] * s3;
+                    T c1 = a[4] * s5 - a[6] * s2 + a[7] * s1;
+                    T c2 = a[4] * s4 - a[5] * s2 + a[7] * s0;
+                    T c3 = a[4] * s3 - a[5] * s1 + a[6] * s0;
+                    determinants[m] = a[0] * c0 - a[1] * c1 + a[2] * c2 - a[3] * c3;
+                    break;
+                }
+            }
+        }
+    }
+
+    /**
+     * Metóda batchLuScalar predstavuje skalárne jadro LU rozkladu s čiastočným pivotovaním jednej matice uloženej po riadkoch
+     * (skupina s jednou maticou).
+     *
+     * @tparam T dátový typ prvkov
+     * @param group prvky matice po riadkoch (prepíšu sa)
+     * @param determinants výstup: determinant matice
+     * @param size stupeň matice
+     */
+    template<typename T>
+    static void batchLuScalar(T* group, T* determinants, int size) {
+        T determinant = 1;
+        for (int k = 0; k < size; ++k) {
+            int pivotRow = k;
+            for (int r = k + 1; r < size; ++r) {
+                if (std::abs(group[r * size + k]) > std::abs(group[pivotRow * size + k])) {
+                    pivotRow = r;
+                }
+            }
+            if (pivotRow != k) {
+                for (int j = k; j < size; ++j) {
+                    std::swap(group[k * size + j], group[pivotRow * size + j]);
+                }
+                determinant = -determinant;
+            }
+            T pivot = group[k * size + k];
+            determinant *= pivot;
+            if (pivot == 0) {
+                break;
+            }
+            T inverse = T(1) / pivot;
+            for (int r = k + 1; r < size; ++r) {
+                T factor = group[r * size + k] * inverse;
+                for (int j = k + 1; j < size; ++j) {
+                    group[r * size + j] -= factor * group[k * size + j];
+                }
+            }
+        }
+        determinants[0] = determinant;
+    }
+
+    /**
+     * Metóda modularRowUpdateScalar predstavuje skalárne jadro modulárnej úpravy riadku.
+     *
+     * @param target upravovaný riadok
+     * @param source riadok pivota
+     * @param factor násobok riadku pivota
+     * @param prime prvočíslo
+     * @param negatedInverse -prime^(-1) mod 2^32
+     * @param count počet prvkov
+     */
+    static void modularRowUpdateScalar(std::uint32_t* target, const std::uint32_t* source, std::uint32_t factor, std::uint32_t prime, std::uint32_t negatedInverse, int count) {
+        for (int k = 0; k < count; ++k) {
+            // Montgomeryho súčin source[k] * factor (redukcia REDC)
+            std::uint64_t product = static_cast<std::uint64_t>(source[k]) * factor;
+            std::uint32_t m = static_cast<std::uint32_t>(product) * negatedInverse;
+            std::uint32_t reduced = static_cast<std::uint32_t>((product + static_cast<std::uint64_t>(m) * prime) >> 32);
+            reduced = reduced >= prime ? reduced - prime : reduced;
+            target[k] = target[k] >= reduced ? target[k] - reduced : target[k] + prime - reduced;
+        }
+    }
+
+#ifdef BAKALARSKAPRACA_X86
+    /**
+     * Jadrá úpravy riadku pre jednotlivé sady inštrukcií. Nastavenie hodnôt blízkych nule na 0 je realizované
+     * vektorovou maskou (porovnanie s -delta a delta a vynulovanie vybraných prvkov), zvyšok riadku spracuje skalárna časť.
+     */
+    BAKALARSKAPRACA_TARGET("sse2")
+    static void rowUpdateSse2(double* target, const double* source, double factor, double delta, int count) {
+        __m128d vFactor = _mm_set1_pd(factor);
+        __m128d vDelta = _mm_set1_pd(delta);
+        __m128d vNegDelta = _mm_set1_pd(-delta);
+        int k = 0;
+        for (; k + 2 <= count; k += 2) {
+            __m128d value = _mm_add_pd(_mm_loadu_pd(target + k), _mm_mul_pd(_mm_loadu_pd(source + k), vFactor));
+            __m128d nearZero = _mm_and_pd(_mm_cmplt_pd(value, vDelta), _mm_cmpgt_pd(value, vNegDelta));
+            _mm_storeu_pd(target + k, _mm_andnot_pd(nearZero, value));
+        }
+        rowUpdateScalar(target + k, source + k, factor, delta, count - k);
+    }
+
+    BAKALARSKAPRACA_TARGET("sse2")
+    static void rowUpdateSse2(float* target, const float* source, float factor, float delta, int count) {
+        __m128 vFactor = _mm_set1_ps(factor);
+        __m128 vDelta = _mm_set1_ps(delta);
+        __m128 vNegDelta = _mm_set1_ps(-delta);
+        int k = 0;
+        for (; k + 4 <= count; k += 4) {
+            __m128 value = _mm_add_ps(_mm_loadu_ps(target + k), _mm_mul_ps(_mm_loadu_ps(source + k), vFactor));
+            __m128 nearZero = _mm_and_ps(_mm_cmplt_ps(value, vDelta), _mm_cmpgt_ps(value, vNegDelta));
+            _mm_storeu_ps(target + k, _mm_andnot_ps(nearZero, value));
+        }
+        rowUpdateScalar(target + k, source + k, factor, delta, count - k);
+    }
+
+    BAKALARSKAPRACA_TARGET("avx2")
+    static void rowUpdateAvx2(double* target, const double* source, double factor, double delta, int count) {
+        __m256d vFactor = _mm256_set1_pd(factor);
+        __m256d vDelta = _mm256_set1_pd(delta);
+        __m256d vNegDelta = _mm256_set1_pd(-delta);
+        int k = 0;
+        for (; k + 4 <= count; k += 4) {
+            __m256d value = _mm256_add_pd(_mm256_loadu_pd(target + k), _mm256_mul_pd(_mm256_loadu_pd(source + k), vFactor));
+            __m256d nearZero = _mm256_and_pd(_mm256_cmp_pd(value, vDelta, _CMP_LT_OQ), _mm256_cmp_pd(value, vNegDelta, _CMP_GT_OQ));
+            _mm256_storeu_pd(target + k, _mm256_andnot_pd(nearZero, value));
+        }
+        rowUpdateScalar(target + k, source + k, factor, delta, count - k);
+    }
+
+    BAKALARSKAPRACA_TARGET("avx2")
+    static void rowUpdateAvx2(float* target, const float* source, float factor, float delta, int count) {
+        __m256 vFactor = _mm256_set1_ps(factor);
+        __m256 vDelta = _mm256_set1_ps(delta);
+        __m256 vNegDelta = _mm256_set1_ps(-delta);
+        int k = 0;
+        for (; k + 8 <= count; k += 8) {
+            __m256 value = _mm256_add_ps(_mm256_loadu_ps(target + k), _mm256_mul_ps(_mm256_loadu_ps(source + k), vFactor));
+            __m256 nearZero = _mm256_and_ps(_mm256_cmp_ps(value, vDelta, _CMP_LT_OQ), _mm256_cmp_ps(value, vNegDelta, _CMP_GT_OQ));
+            _mm256_storeu_ps(target + k, _mm256_andnot_ps(nearZero, value));
+        }
+        rowUpdateScalar(target + k, source + k, factor, delta, count - k);
+    }
+
+    BAKALARSKAPRACA_TARGET("avx512f")
+    static void rowUpdateAvx512(double* target, const double* source, double factor, double delta, int count) {
+        __m512d vFactor = _mm512_set1_pd(factor);
+        __m512d vDelta = _mm512_set1_pd(delta);
+        __m512d vNegDelta = _mm512_set1_pd(-delta);
+        for (int k = 0; k < count; k += 8) {
+            // posledný neúplný vektor sa spracuje maskovaným načítaním a zápisom
+            __mmask8 lanes = count - k >= 8 ? static_cast<__mmask8>(0xFF) : static_cast<__mmask8>((1u << (count - k)) - 1);
+            __m512d value = _mm512_add_pd(_mm512_maskz_loadu_pd(lanes, target + k), _mm512_mul_pd(_mm512_maskz_loadu_pd(lanes, source + k), vFactor));
+            __mmask8 nearZero = _mm512_cmp_pd_mask(value, vDelta, _CMP_LT_OQ) & _mm512_cmp_pd_mask(value, vNegDelta, _CMP_GT_OQ);
+            _mm512_mask_storeu_pd(target + k, lanes, _mm512_maskz_mov_pd(static_cast<__mmask8>(~nearZero), value));
+        }
+    }
+
+    BAKALARSKAPRACA_TARGET("avx512f")
+    static void rowUpdateAvx512(float* target, const float* source, float factor, float delta, int count) {
+        __m512 vFactor = _mm512_set1_ps(factor);
+        __m512 vDelta = _mm512_set1_ps(delta);
+        __m512 vNegDelta = _mm512_set1_ps(-delta);
+        for (int k = 0; k < count; k += 16) {
+            // posledný neúplný vektor sa spracuje maskovaným načítaním a zápisom
+            __mmask16 lanes = count - k >= 16 ? static_cast<__mmask16>(0xFFFF) : static_cast<__mmask16>((1u << (count - k)) - 1);
+            __m512 value = _mm512_add_ps(_mm512_maskz_loadu_ps(lanes, target + k), _mm512_mul_ps(_mm512_maskz_loadu_ps(lanes, source + k), vFactor));
+            __mmask16 nearZero = _mm512_cmp_ps_mask(value, vDelta, _CMP_LT_OQ) & _mm512_cmp_ps_mask(value, vNegDelta, _CMP_GT_OQ);
+            _mm512_mask_storeu_ps(target + k, lanes, _mm512_maskz_mov_ps(static_cast<__mmask16>(~nearZero), value));
+        }
+    }
+
+    /**
+     * Jadrá modulárnej úpravy riadku. Inštrukcia mul_epu32 násobí iba párne 32-bitové prvky, preto sa súčiny
+     * párnych a nepárnych prvkov redukujú zvlášť a výsledky sa spoja. Podmienené odčítanie (pripočítanie) prvočísla
+     * nahrádza minimum bez znamienka: ak x < p, tak x - p pretečie na číslo väčšie ako x.
+     * SSE2 nemá minimum 32-bitových čísel bez znamienka, pre túto sadu sa používa skalárne jadro.
+     */
+    BAKALARSKAPRACA_TARGET("avx2")
+    static void modularRowUpdateAvx2(std::uint32_t* target, const std::uint32_t* source, std::uint32_t factor, std::uint32_t prime, std::uint32_t negatedInverse, int count) {
+        __m256i vFactor = _mm256_set1_epi32(static_cast<int>(factor));
+        __m256i vPrime = _mm256_set1_epi32(static_cast<int>(prime));
+        __m256i vInverse = _mm256_set1_epi32(static_cast<int>(negatedInverse));
+        int k = 0;
+        for (; k + 8 <= count; k += 8) {
+            __m256i value = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(source + k));
+            __m256i productEven = _mm256_mul_epu32(value, vFactor);
+            __m256i productOdd = _mm256_mul_epu32(_mm256_srli_epi64(value, 32), vFactor);
+            __m256i reducedEven = _mm256_srli_epi64(_mm256_add_epi64(productEven, _mm256_mul_epu32(_mm256_mul_epu32(productEven, vInverse), vPrime)), 32);
+            __m256i reducedOdd = _mm256_add_epi64(productOdd, _mm256_mul_epu32(_mm256_mul_epu32(productOdd, vInverse), vPrime));
+            __m256i product = _mm256_blend_epi32(reducedEven, reducedOdd, 0xAA);
+            product = _mm256_min_epu32(product, _mm256_sub_epi32(product, vPrime));
+            __m256i result = _mm256_sub_epi32(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(target + k)), product);
+            result = _mm256_min_epu32(result, _mm256_add_epi32(result, vPrime));
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(target + k), result);
+        }
+        modularRowUpdateScalar(target + k, source + k, factor, prime, negatedInverse, count - k);
+    }
+
+    // GCC 12 hlási pri celočíselných AVX-512 intrinsics falošné varovanie o neinicializovanej premennej v ich hlavičkách
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#endif
+    BAKALARSKAPRACA_TARGET("avx512f")
+    static void modularRowUpdateAvx512(std::uint32_t* target, const std::uint32_t* source, std::uint32_t factor, std::uint32_t prime, std::uint32_t negatedInverse, int count) {
+        __m512i vFactor = _mm512_set1_epi32(static_cast<int>(factor));
+        __m512i vPrime = _mm512_set1_epi32(static_cast<int>(prime));
+        __m512i vInverse = _mm512_set1_epi32(static_cast<int>(negatedInverse));
+        for (int k = 0; k < count; k += 16) {
+            // posledný neúplný vektor sa spracuje maskovaným načítaním a zápisom
+            __mmask16 lanes = count - k >= 16 ? static_cast<__mmask16>(0xFFFF) : static_cast<__mmask16>((1u << (count - k)) - 1);
+            __m512i value = _mm512_maskz_loadu_epi32(lanes, source + k);
+            __m512i productEven = _mm512_mul_epu32(value, vFactor);
+            __m512i productOdd = _mm512_mul_epu32(_mm512_srli_epi64(value, 32), vFactor);
+            __m512i reducedEven = _mm512_srli_epi64(_mm512_add_epi64(productEven, _mm512_mul_epu32(_mm512_mul_epu32(productEven, vInverse), vPrime)), 32);
+            __m512i reducedOdd = _mm512_add_epi64(productOdd, _mm512_mul_epu32(_mm512_mul_epu32(productOdd, vInverse), vPrime));
+            __m512i product = _mm512_mask_blend_epi32(static_cast<__mmask16>(0xAAAA), reducedEven, reducedOdd);
+            product = _mm512_min_epu32(product, _mm512_sub_epi32(product, vPrime));
+            __m512i result = _mm512_sub_epi32(_mm512_maskz_loadu_epi32(lanes, target + k), product);
+            result = _mm512_min_epu32(result, _mm512_add_epi32(result, vPrime));
+            _mm512_mask_storeu_epi32(target + k, lanes, result);
+        }
+    }
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+
+    /**
+     * Metóda selectModularRowUpdateKernel vyberie jadro modulárnej úpravy riadku podľa podporovanej sady inštrukcií.
+     *
+     * @return ukazovateľ na jadro modulárnej úpravy riadku
+     */
+    static ModularRowUpdateKernel selectModularRowUpdateKernel() {
+        switch (getSimdLevel()) {
+            case SIMD_AVX512: return &modularRowUpdateAvx512;
+            case SIMD_AVX2: return &modularRowUpdateAvx2;
+            default: return &modularRowUpdateScalar;
+        }
+    }
+
+    /**
+     * Metóda selectRowUpdateKernel vyberie jadro úpravy riadku podľa podporovanej sady inštrukcií.
+     *
+     * @tparam T dátový typ prvkov (float alebo double)
+     * @return ukazovateľ na jadro úpravy riadku
+     */
+    template<typename T>
+    static RowUpdateKernel<T> selectRowUpdateKernel() {
+        switch (getSimdLevel()) {
+            case SIMD_AVX512: return static_cast<RowUpdateKernel<T>>(&rowUpdateAvx512);
+            case SIMD_AVX2: return static_cast<RowUpdateKernel<T>>(&rowUpdateAvx2);
+            case SIMD_SSE2: return static_cast<RowUpdateKernel<T>>(&rowUpdateSse2);
+            default: return &rowUpdateScalar<T>;
+        }
+    }
+
+    /**
+     * Jadrá úpravy dlaždice pre jednotlivé sady inštrukcií. Dlaždica má TILE_ROWS riadkov a dva vektory stĺpcov,
+     * jej medzisúčty sú v ôsmich vektorových registroch a v každom kroku sa načíta iba jeden riadok U a TILE_ROWS prvkov L.
+     */
+#define BAKALARSKAPRACA_TILE_UPDATE(NAME, ISA, T, VEC, WIDTH, LOAD, STORE, SET1, ZERO, FMADD, SUB)                  \
+    BAKALARSKAPRACA_TARGET(ISA)                                                                                   \
+    static void NAME(T** rows, int row, int panelStart, int panelEnd, int column) {                               \
+        T* row0 = rows[row];                                                                                      \
+        T* row1 = rows[row + 1];                                                                                  \
+        T* row2 = rows[row + 2];                                                                                  \
+        T* row3 = rows[row + 3];                                                                                  \
+        VEC c00 = ZERO(), c01 = ZERO(), c10 = ZERO(), c11 = ZERO();                                               \
+        VEC c20 = ZERO(), c21 = ZERO(), c30 = ZERO(), c31 = ZERO();                                               \
+        for (int p = panelStart; p < panelEnd; ++p) {                                                             \
+            const T* source = rows[p] + column;                                                                   \
+            VEC u0 = LOAD(source);                                                                                \
+            VEC u1 = LOAD(source + WIDTH);                                                                        \
+            VEC l = SET1(row0[p]);                                                                                \
+            c00 = FMADD(l, u0, c00); c01 = FMADD(l, u1, c01);                                                     \
+            l = SET1(row1[p]);                                                                                    \
+            c10 = FMADD(l, u0, c10); c11 = FMADD(l, u1, c11);                                                     \
+            l = SET1(row2[p]);                                                                                    \
+            c20 = FMADD(l, u0, c20); c21 = FMADD(l, u1, c21);                                                     \
+            l = SET1(row3[p]);                                                                                    \
+            c30 = FMADD(l, u0, c30); c31 = FMADD(l, u1, c31);                                                     \
+        }                                                                                                         \
+        STORE(row0 + column, SUB(LOAD(row0 + column), c00)); STORE(row0 + column + WIDTH, SUB(LOAD(row0 + column + WIDTH), c01)); \
+        STORE(row1 + column, SUB(LOAD(row1 + column), c10)); STORE(row1 + column + WIDTH, SUB(LOAD(row1 + column + WIDTH), c11)); \
+        STORE(row2 + column, SUB(LOAD(row2 + column), c20)); STORE(row2 + column + WIDTH, SUB(LOAD(row2 + column + WIDTH), c21)); \
+        STORE(row3 + column, SUB(LOAD(row3 + column), c30)); STORE(row3 + column + WIDTH, SUB(LOAD(row3 + column + WIDTH), c31)); \
+    }
+
+    BAKALARSKAPRACA_TILE_UPDATE(tileUpdateSse2, "sse2", double, __m128d, 2, _mm_loadu_pd, _mm_storeu_pd, _mm_set1_pd, _mm_setzero_pd, BAKALARSKAPRACA_MULADD_PD, _mm_sub_pd)
+    BAKALARSKAPRACA_TILE_UPDATE(tileUpdateSse2, "sse2", float, __m128, 4, _mm_loadu_ps, _mm_storeu_ps, _mm_set1_ps, _mm_setzero_ps, BAKALARSKAPRACA_MULADD_PS, _mm_sub_ps)
+    BAKALARSKAPRACA_TILE_UPDATE(tileUpdateAvx2, "avx2,fma", double, __m256d, 4, _mm256_loadu_pd, _mm256_storeu_pd, _mm256_set1_pd, _mm256_setzero_pd, _mm256_fmadd_pd, _mm256_sub_pd)
+    BAKALARSKAPRACA_TILE_UPDATE(tileUpdateAvx2, "avx2,fma", float, __m256, 8, _mm256_loadu_ps, _mm256_storeu_ps, _mm256_set1_ps, _mm256_setzero_ps, _mm256_fmadd_ps, _mm256_sub_ps)
+    BAKALARSKAPRACA_TILE_UPDATE(tileUpdateAvx512, "avx512f", double, __m512d, 8, _mm512_loadu_pd, _mm512_storeu_pd, _mm512_set1_pd, _mm512_setzero_pd, _mm512_fmadd_pd, _mm512_sub_pd)
+    BAKALARSKAPRACA_TILE_UPDATE(tileUpdateAvx512, "avx512f", float, __m512, 16, _mm512_loadu_ps, _mm512_storeu_ps, _mm512_set1_ps, _mm512_setzero_ps, _mm512_fmadd_ps, _mm512_sub_ps)
+#undef BAKALARSKAPRACA_TILE_UPDATE
+
+    /**
+     * Jadrá dávkového výpočtu determinantov pre jednotlivé sady inštrukcií. Vektor obsahuje rovnaký prvok WIDTH susedných matíc,
+     * vzorce sú rovnaké ako v skalárnom jadre (bez FMA, aby sa výsledky zhodovali), zvyšok dávky spracuje skalárne jadro.
+     */
+#define BAKALARSKAPRACA_BATCH_DETERMINANT(NAME, ISA, T, VEC, WIDTH, LOAD, STORE, MUL, ADD, SUB)                     \
+    BAKALARSKAPRACA_TARGET(ISA)                                                                                   \
+    static void NAME(const T* elements, std::size_t stride, T* determinants, std::size_t count, int size) {      \
+        std::size_t m = 0;                                                                                        \
+        VEC a[BATCH_MAX_SIZE * BATCH_MAX_SIZE];                                                                   \
+        switch (size) {                                                                                           \
+            case 2:                                                                                               \
+                for (; m + WIDTH <= count; m += WIDTH) {                                                          \
+                    for (int e = 0; e < 4; ++e) { a[e] = LOAD(elements + e * stride + m); }                       \
+                    STORE(determinants + m, SUB(MUL(a[0], a[3]), MUL(a[1], a[2])));                               \
+                }                                                                                                 \
+                break;                                                                                            \
+            case 3:                                                                                               \
+                for (; m + WIDTH <= count; m += WIDTH) {                                                          \
+                    for (int e = 0; e < 9; ++e) { a[e] = LOAD(elements + e * stride + m); }                       \
+                    VEC sum = ADD(ADD(MUL(MUL(a[0], a[4]), a[8]), MUL(MUL(a[1], a[5]), a[6])), MUL(MUL(a[2], a[3]), a[7])); \
+                    sum = SUB(SUB(SUB(sum, MUL(MUL(a[2], a[4]), a[6])), MUL(MUL(a[0], a[5]), a[7])), MUL(MUL(a[1], a[3]), a[8])); \
+                    STORE(determinants + m, sum);                                                                 \
+                }                                                                                                 \
+                break;                                                                                            \
+            case 4:                                                                                               \
+                for (; m + WIDTH <= count; m += WIDTH) {                                                          \
+                    for (int e = 0; e < 16; ++e) { a[e] = LOAD(elements + e * stride + m); }                      \
+                    VEC s0 = SUB(MUL(a[8], a[13]), MUL(a[9], a[12]));                                             \
+                    VEC s1 = SUB(MUL(a[8], a[14]), MUL(a[10], a[12]));                                            \
+                    VEC s2 = SUB(MUL(a[8], a[15]), MUL(a[11], a[12]));                                            \
+                    VEC s3 = SUB(MUL(a[9], a[14]), MUL(a[10], a[13]));                                            \
+                    VEC s4 = SUB(MUL(a[9], a[15]), MUL(a[11], a[13]));                                            \
+                    VEC s5 = SUB(MUL(a[10], a[15]), MUL(a[11], a[14]));                                           \
+                    VEC c0 = ADD(SUB(MUL(a[5], s5), MUL(a[6], s4)), MUL(a[7], s3));                               \
+                    VEC c1 = ADD(SUB(MUL(a[4], s5), MUL(a[6], s2)), MUL(a[7], s1));                               \
+                    VEC c2 = ADD(SUB(MUL(a[4], s4), MUL(a[5], s2)), MUL(a[7], s0));                               \
+                    VEC c3 = ADD(SUB(MUL(a[4], s3), MUL(a[5], s1)), MUL(a[6], s0));                               \
+                    STORE(determinants + m, SUB(ADD(SUB(MUL(a[0], c0), MUL(a[1], c1)), MUL(a[2], c2)), MUL(a[3], c3))); \
+                }                                                                                                 \
+                break;                                                                                            \
+            default:                                                                                              \
+                break;                                                                                            \
+        }                                                                                                         \
+        batchDeterminantScalar<T>(elements + m, stride, determinants + m, count - m, size);                       \
+    }
+
+    BAKALARSKAPRACA_BATCH_DETERMINANT(batchDeterminantSse2, "sse2", double, __m128d, 2, _mm_loadu_pd, _mm_storeu_pd, _mm_mul_pd, _mm_add_pd, _mm_sub_pd)
+    BAKALARSKAPRACA_BATCH_DETERMINANT(batchDeterminantSse2, "sse2", float, __m128, 4, _mm_loadu_ps, _mm_storeu_ps, _mm_mul_ps, _mm_add_ps, _mm_sub_ps)
+    BAKALARSKAPRACA_BATCH_DETERMINANT(batchDeterminantAvx2, "avx2", double, __m256d, 4, _mm256_loadu_pd, _mm256_storeu_pd, _mm256_mul_pd, _mm256_add_pd, _mm256_sub_pd)
+    BAKALARSKAPRACA_BATCH_DETERMINANT(batchDeterminantAvx2, "avx2", float, __m256, 8, _mm256_loadu_ps, _mm256_storeu_ps, _mm256_mul_ps, _mm256_add_ps, _mm256_sub_ps)
+    BAKALARSKAPRACA_BATCH_DETERMINANT(batchDeterminantAvx512, "avx512f", double, __m512d, 8, _mm512_loadu_pd, _mm512_storeu_pd, _mm512_mul_pd, _mm512_add_pd, _mm512_sub_pd)
+    BAKALARSKAPRACA_BATCH_DETERMINANT(batchDeterminantAvx512, "avx512f", float, __m512, 16, _mm512_loadu_ps, _mm512_storeu_ps, _mm512_mul_ps, _mm512_add_ps, _mm512_sub_ps)
+#undef BAKALARSKAPRACA_BATCH_DETERMINANT
+
+    /**
+     * Jadrá LU rozkladu prekladaných matíc. Pivot sa hľadá pre každú zložku zvlášť (vektor indexov riadkov), výmena riadkov
+     * sa vykoná zmiešaním riadku k s riadkom r iba v zložkách, ktorých pivot je v riadku r (lane-masked pivoting),
+     * a riadky, ktoré si za pivot nevybrala žiadna zložka, sa preskočia. Zložky so singulárnou maticou delia jednotkou,
+     * aby sa do ostatných výpočtov nedostali nekonečná, ich determinant ostane 0.
+     */
+#define BAKALARSKAPRACA_BATCH_LU(NAME, ISA, T, VEC, MASK, WIDTH, LOAD, STORE, SET1, MUL, DIV, FNMADD, ABS, GT, EQ, BLEND, ANY) \
+    BAKALARSKAPRACA_TARGET(ISA)                                                                                   \
+    static void NAME(T* group, T* determinants, int size) {                                                       \
+        VEC determinant = SET1(1);                                                                                \
+        for (int k = 0; k < size; ++k) {                                                                          \
+            T* pivotLine = group + static_cast<std::size_t>(k) * size * WIDTH;                                    \
+            VEC largest = ABS(LOAD(pivotLine + k * WIDTH));                                                       \
+            VEC pivotRow = SET1(static_cast<T>(k));                                                               \
+            for (int r = k + 1; r < size; ++r) {                                                                  \
+                VEC candidate = ABS(LOAD(group + (static_cast<std::size_t>(r) * size + k) * WIDTH));              \
+                MASK larger = GT(candidate, largest);                                                             \
+                largest = BLEND(largest, candidate, larger);                                                      \
+                pivotRow = BLEND(pivotRow, SET1(static_cast<T>(r)), larger);                                      \
+            }                                                                                                     \
+            for (int r = k + 1; r < size; ++r) {                                                                  \
+                MASK swap = EQ(pivotRow, SET1(static_cast<T>(r)));                                                \
+                if (!ANY(swap)) {                                                                                 \
+                    continue;                                                                                     \
+                }                                                                                                 \
+                T* line = group + static_cast<std::size_t>(r) * size * WIDTH;                                     \
+                for (int j = k; j < size; ++j) {                                                                  \
+                    VEC upper = LOAD(pivotLine + j * WIDTH);                                                      \
+                    VEC lower = LOAD(line + j * WIDTH);                                                           \
+                    STORE(pivotLine + j * WIDTH, BLEND(upper, lower, swap));                                      \
+                    STORE(line + j * WIDTH, BLEND(lower, upper, swap));                                           \
+                }                                                                                                 \
+                determinant = BLEND(determinant, MUL(determinant, SET1(-1)), swap);                               \
+            }                                                                                                     \
+            VEC pivot = LOAD(pivotLine + k * WIDTH);                                                              \
+            determinant = MUL(determinant, pivot);                                                                \
+            VEC inverse = DIV(SET1(1), BLEND(pivot, SET1(1), EQ(pivot, SET1(0))));                                \
+            for (int r = k + 1; r < size; ++r) {                                                                  \
+                T* line = group + static_cast<std::size_t>(r) * size * WIDTH;                                     \
+                VEC factor = MUL(LOAD(line + k * WIDTH), inverse);                                                \
+                for (int j = k + 1; j < size; ++j) {                                                              \
+                    STORE(line + j * WIDTH, FNMADD(factor, LOAD(pivotLine + j * WIDTH), LOAD(line + j * WIDTH))); \
+                }                                                                                                 \
+            }                                                                                                     \
+        }                                                                                                         \
+        STORE(determinants, determinant);                                                                         \
+    }
+
+#define BAKALARSKAPRACA_ABS256_PD(a) _mm256_andnot_pd(_mm256_set1_pd(-0.0), a)
+#define BAKALARSKAPRACA_ABS256_PS(a) _mm256_andnot_ps(_mm256_set1_ps(-0.0f), a)
+#define BAKALARSKAPRACA_GT256_PD(a, b) _mm256_cmp_pd(a, b, _CMP_GT_OQ)
+#define BAKALARSKAPRACA_GT256_PS(a, b) _mm256_cmp_ps(a, b, _CMP_GT_OQ)
+#define BAKALARSKAPRACA_EQ256_PD(a, b) _mm256_cmp_pd(a, b, _CMP_EQ_OQ)
+#define BAKALARSKAPRACA_EQ256_PS(a, b) _mm256_cmp_ps(a, b, _CMP_EQ_OQ)
+#define BAKALARSKAPRACA_ANY256_PD(mask) (_mm256_movemask_pd(mask) != 0)
+#define BAKALARSKAPRACA_ANY256_PS(mask) (_mm256_movemask_ps(mask) != 0)
+#define BAKALARSKAPRACA_GT512_PD(a, b) _mm512_cmp_pd_mask(a, b, _CMP_GT_OQ)
+#define BAKALARSKAPRACA_GT512_PS(a, b) _mm512_cmp_ps_mask(a, b, _CMP_GT_OQ)
+#define BAKALARSKAPRACA_EQ512_PD(a, b) _mm512_cmp_pd_mask(a, b, _CMP_EQ_OQ)
+#define BAKALARSKAPRACA_EQ512_PS(a, b) _mm512_cmp_ps_mask(a, b, _CMP_EQ_OQ)
+#define BAKALARSKAPRACA_BLEND512_PD(a, b, mask) _mm512_mask_blend_pd(mask, a, b)
+#define BAKALARSKAPRACA_BLEND512_PS(a, b, mask) _mm512_mask_blend_ps(mask, a, b)
+#define BAKALARSKAPRACA_ANY512(mask) (mask != 0)
+
+    BAKALARSKAPRACA_BATCH_LU(batchLuAvx2, "avx2,fma", double, __m256d, __m256d, 4, _mm256_loadu_pd, _mm256_storeu_pd, _mm256_set1_pd, _mm256_mul_pd, _mm256_div_pd, _mm256_fnmadd_pd,
+                             BAKALARSKAPRACA_ABS256_PD, BAKALARSKAPRACA_GT256_PD, BAKALARSKAPRACA_EQ256_PD, _mm256_blendv_pd, BAKALARSKAPRACA_ANY256_PD)
+    BAKALARSKAPRACA_BATCH_LU(batchLuAvx2, "avx2,fma", float, __m256, __m256, 8, _mm256_loadu_ps, _mm256_storeu_ps, _mm256_set1_ps, _mm256_mul_ps, _mm256_div_ps, _mm256_fnmadd_ps,
+                             BAKALARSKAPRACA_ABS256_PS, BAKALARSKAPRACA_GT256_PS, BAKALARSKAPRACA_EQ256_PS, _mm256_blendv_ps, BAKALARSKAPRACA_ANY256_PS)
+    BAKALARSKAPRACA_BATCH_LU(batchLuAvx512, "avx512f", double, __m512d, __mmask8, 8, _mm512_loadu_pd, _mm512_storeu_pd, _mm512_set1_pd, _mm512_mul_pd, _mm512_div_pd, _mm512_fnmadd_pd,
+                             _mm512_abs_pd, BAKALARSKAPRACA_GT512_PD, BAKALARSKAPRACA_EQ512_PD, BAKALARSKAPRACA_BLEND512_PD, BAKALARSKAPRACA_ANY512)
+    BAKALARSKAPRACA_BATCH_LU(batchLuAvx512, "avx512f", float, __m512, __mmask16, 16, _mm512_loadu_ps, _mm512_storeu_ps, _mm512_set1_ps, _mm512_mul_ps, _mm512_div_ps, _mm512_fnmadd_ps,
+                             _mm512_abs_ps, BAKALARSKAPRACA_GT512_PS, BAKALARSKAPRACA_EQ512_PS, BAKALARSKAPRACA_BLEND512_PS, BAKALARSKAPRACA_ANY512)
+#undef BAKALARSKAPRACA_ABS256_PD
+#undef BAKALARSKAPRACA_ABS256_PS
+#undef BAKALARSKAPRACA_GT256_PD
+#undef BAKALARSKAPRACA_GT256_PS
+#undef BAKALARSKAPRACA_EQ256_PD
+#undef BAKALARSKAPRACA_EQ256_PS
+#undef BAKALARSKAPRACA_ANY256_PD
+#undef BAKALARSKAPRACA_ANY256_PS
+#undef BAKALARSKAPRACA_GT512_PD
+#undef BAKALARSKAPRACA_GT512_PS
+#undef BAKALARSKAPRACA_EQ512_PD
+#undef BAKALARSKAPRACA_EQ512_PS
+#undef BAKALARSKAPRACA_BLEND512_PD
+#undef BAKALARSKAPRACA_BLEND512_PS
+#undef BAKALARSKAPRACA_ANY512
+#undef BAKALARSKAPRACA_BATCH_LU
+
+    /**
+     * Metóda selectBatchLuKernel vyberie jadro LU rozkladu prekladaných matíc podľa podporovanej sady inštrukcií.
+     *
+     * @tparam T dátový typ prvkov (float alebo double)
+     * @return jadro LU rozkladu a počet matíc v skupine
+     */
+    template<typename T>
+    static BatchLuKernel<T> selectBatchLuKernel() {
+        switch (getSimdLevel()) {
+            case SIMD_AVX512: return { static_cast<void (*)(T*, T*, int)>(&batchLuAvx512), 64 / static_cast<int>(sizeof(T)) };
+            case SIMD_AVX2: return { static_cast<void (*)(T*, T*, int)>(&batchLuAvx2), 32 / static_cast<int>(sizeof(T)) };
+            default: return { &batchLuScalar<T>, 1 };
+        }
+    }
+
+    /**
+     * Metóda selectBatchDeterminantKernel vyberie jadro dávkového výpočtu determinantov podľa podporovanej sady inštrukcií.
+     *
+     * @tparam T dátový typ prvkov (float alebo double)
+     * @return ukazovateľ na jadro dávkového výpočtu determinantov
+     */
+    template<typename T>
+    static BatchDeterminantKernel<T> selectBatchDeterminantKernel() {
+        switch (getSimdLevel()) {
+            case SIMD_AVX512: return static_cast<BatchDeterminantKernel<T>>(&batchDeterminantAvx512);
+            case SIMD_AVX2: return static_cast<BatchDeterminantKernel<T>>(&batchDeterminantAvx2);
+            case SIMD_SSE2: return static_cast<BatchDeterminantKernel<T>>(&batchDeterminantSse2);
+            default: return &batchDeterminantScalar<T>;
+        }
+    }
+
+    /**
+     * Metóda selectTileUpdateKernel vyberie jadro úpravy dlaždice podľa podporovanej sady inštrukcií.
+     *
+     * @tparam T dátový typ prvkov (float alebo double)
+     * @return jadro úpravy dlaždice a počet jeho stĺpcov
+     */
+    template<typename T>
+    static TileUpdateKernel<T> selectTileUpdateKernel() {
+        constexpr int lanes = 16 / sizeof(T);      // počet prvkov v 128-bitovom vektore
+        switch (getSimdLevel()) {
+            case SIMD_AVX512: return { static_cast<void (*)(T**, int, int, int, int)>(&tileUpdateAvx512), 8 * lanes };
+            case SIMD_AVX2: return { static_cast<void (*)(T**, int, int, int, int)>(&tileUpdateAvx2), 4 * lanes };
+            case SIMD_SSE2: return { static_cast<void (*)(T**, int, int, int, int)>(&tileUpdateSse2), 2 * lanes };
+            default: return { &tileUpdateScalar<T>, SCALAR_TILE_COLUMNS };
+        }
+    }
+#endif
+};
+
+#ifdef BAKALARSKAPRACA_X86
+/**
+ * Špecializácie výberu jadier pre float a double. Jadro sa vyberie iba raz a uloží do statickej premennej.
+ */
+template<>
+inline SimdKernels::RowUpdateKernel<double> SimdKernels::rowUpdateKernel<double>() {
+    static const RowUpdateKernel<double> kernel = selectRowUpdateKernel<double>();
+    return kernel;
+}
+
+template<>
+inline SimdKernels::RowUpdateKernel<float> SimdKernels::rowUpdateKernel<float>() {
+    static const RowUpdateKernel<float> kernel = selectRowUpdateKernel<float>();
+    return kernel;
+}
+
+template<>
+inline SimdKernels::BatchDeterminantKernel<double> SimdKernels::batchDeterminantKernel<double>() {
+    static const BatchDeterminantKernel<double> kernel = selectBatchDeterminantKernel<double>();
+    return kernel;
+}
+
+template<>
+inline SimdKernels::BatchDeterminantKernel<float> SimdKernels::batchDeterminantKernel<float>() {
+    static const BatchDeterminantKernel<float> kernel = selectBatchDeterminantKernel<float>();
+    return kernel;
+}
+
+template<>
+inline SimdKernels::BatchLuKernel<double> SimdKernels::batchLuKernel<double>() {
+    static const BatchLuKernel<double> kernel = selectBatchLuKernel<double>();
+    return kernel;
+}
+
+template<>
+inline SimdKernels::BatchLuKernel<float> SimdKernels::batchLuKernel<float>() {
+    static const BatchLuKernel<float> kernel = selectBatchLuKernel<float>();
+    return kernel;
+}
+
+template<>
+inline SimdKernels::TileUpdateKernel<double> SimdKernels::tileUpdateKernel<double>() {
+    static const TileUpdateKernel<double> kernel = selectTileUpdateKernel<double>();
+    return kernel;
+}
+
+template<>
+inline SimdKernels::TileUpdateKernel<float> SimdKernels::tileUpdateKernel<float>() {
+    static const TileUpdateKernel<float> kernel = selectTileUpdateKernel<float>();
+    return kernel;
+}
+#endif
+
+#endif
@@ -0,0 +1,172 @@
+#ifndef BAKALARSKAPRACA_SPARSEMATRIX_H
+#define BAKALARSKAPRACA_SPARSEMATRIX_H
+
+#include <algorithm>
+#include <cstddef>
+#include <iostream>
+#include <vector>
+#include "Generator.h"
+#include "Matrix.h"
+
+/**
+ * Trieda SparseMatrix reprezentuje riedku štvorcovú maticu uloženú po riadkoch vo formáte CSR (compressed sparse row).
+ * Ukladajú sa iba nenulové prvky: ich hodnoty a stĺpce po riadkoch za sebou a pre každý riadok index jeho prvého prvku,
+ * takže pamäť aj prechod maticou sú úmerné počtu nenulových prvkov, nie štvorcu stupňa.
+ *
+ * @tparam T dátový typ prvkov matice
+ */
+template<class T>
+class SparseMatrix {
+private:
+    int size_;                          // stupeň (veľkosť) štvorcovej matice
+    std::vector<int> rowStarts_;        // index prvého prvku každého riadku (size + 1 prvkov, posledný je počet prvkov)
+    std::vector<int> columnIndices_;    // stĺpce nenulových prvkov (v rámci riadku vzostupne)
+    std::vector<T> values_;             // hodnoty nenulových prvkov
+public:
+    /**
+     * Konštruktor pre nulovú riedku maticu.
+     *
+     * @param size stupeň (veľkosť) štvorcovej matice
+     */
+    explicit SparseMatrix(int size) : size_(size), rowStarts_(size + 1, 0) {};
+
+    /**
+     * Konštruktor, ktorý prevedie hustú maticu na riedku (uložia sa iba nenulové prvky).
+     *
+     * @param matrix referencia na hustú maticu
+     */
+    explicit SparseMatrix(Matrix<T>& matrix) : SparseMatrix(matrix.getSize()) {
+        for (int i = 0; i < size_; ++i) {
+            setRow(i, matrix[i]);
+        }
+    }
+
+    /**
+     * Metóda generateValues slúži na vygenerovanie hodnôt prvkov matice. Generátor vygeneruje rovnakú postupnosť prvkov
+     * ako pre hustú maticu (Matrix::generateValues), uložia sa iba nenulové prvky. V pásovom režime generátora sa
+     * prechádzajú iba prvky v pásme a nenulové prvky sa pripájajú priamo na koniec riadku, takže generovanie trvá
+     * n * (2 * bandwidth + 1) krokov a nie štvorec stupňa.
+     *
+     * @tparam G dátový typ generovaných dát
+     * @param generator referencia na generátor, ktorý generuje hodnoty pre prvky matice
+     */
+    template<typename G>
+    void generateValues(Generator<G>& generator) {
+        clear();
+        int bandwidth = generator.getBandwidth() < 0 ? size_ : generator.getBandwidth();
+        for (int i = 0; i < size_; ++i) {
+            int first = std::max(i - bandwidth, 0);
+            int last = std::min(i + bandwidth, size_ - 1);
+            for (int j = first; j <= last; ++j) {
+                T value = generator.generate(i, j);
+                if (value != 0) {
+                    columnIndices_.push_back(j);
+                    values_.push_back(value);
+                }
+            }
+            rowStarts_[i + 1] = static_cast<int>(values_.size());
+        }
+    }
+
+    /**
+     * Metóda setRow uloží nenulové prvky riadku zadaného v hustom tvare. Riadky sa musia nastavovať postupne od prvého,
+     * nasledujúce riadky sa pri tom zahodia.
+     *
+     * @param row index riadku
+     * @param elements prvky riadku (size prvkov)
+     */
+    void setRow(int row, const T* elements) {
+        if (row < 0 || row >= size_) {
+            std::cerr << "Invalid row of the sparse matrix: " << row << std::endl;
+            return;
+        }
+        values_.resize(rowStarts_[row]);
+        columnIndices_.resize(rowStarts_[row]);
+        for (int j = 0; j < size_; ++j) {
+            if (elements[j] != 0) {
+                columnIndices_.push_back(j);
+                values_.push_back(elements[j]);
+            }
+        }
+        std::fill(rowStarts_.begin() + row + 1, rowStarts_.end(), static_cast<int>(values_.size()));
+    }
+
+    /**
+     * Metóda clear vynuluje všetky prvky matice (kapacita pamäte ostane zachovaná).
+     */
+    void clear() {
+        std::fill(rowStarts_.begin(), rowStarts_.end(), 0);
+        columnIndices_.clear();
+        values_.clear();
+    }
+
+    /**
+     * Getter pre stupeň (veľkosť) štvorcovej matice.
+     *
+     * @return stupeň (veľkosť) štvorcovej matice
+     */
+    int getSize() const {
+        return size_;
+    }
+
+    /**
+     * Getter pre počet nenulových prvkov.
+     *
+     * @return počet nenulových prvkov
+     */
+    std::size_t getNonzeroCount() const {
+        return values_.size();
+    }
+
+    /**
+     * Metóda getDensity vráti podiel nenulových prvkov matice.
+     *
+     * @return hustota matice (0 až 1)
+     */
+    double getDensity() const {
+        return size_ == 0 ? 0 : static_cast<double>(values_.size()) / (static_cast<double>(size_) * size_);
+    }
+
+    /**
+     * Getter pre indexy prvých prvkov riadkov (prvky riadku i sú na indexoch rowStarts[i] až rowStarts[i + 1] - 1).
+     *
+     * @return ukazovateľ na indexy prvých prvkov riadkov
+     */
+    const int* getRowStarts() const {
+        return rowStarts_.data();
+    }
+
+    /**
+     * Getter pre stĺpce nenulových prvkov.
+     *
+     * @return ukazovateľ na stĺpce nenulových prvkov
+     */
+    const int* getColumnIndices() const {
+        return columnIndices_.data();
+    }
+
+    /**
+     * Getter pre hodnoty nenulových prvkov.
+     *
+     * @return ukazovateľ na hodnoty nenulových prvkov
+     */
+    const T* getValues() const {
+        return values_.data();
+    }
+
+    /**
+     * Operátor () slúži na čítanie prvku matice (stĺpec sa v riadku vyhľadá binárne).
+     *
+     * @param row index riadku
+     * @param column index stĺpca
+     * @return hodnota prvku (0, ak prvok nie je uložený)
+     */
+    T operator()(int row, int column) const {
+        auto begin = columnIndices_.begin() + rowStarts_[row];
+        auto end = columnIndices_.begin() + rowStarts_[row + 1];
+        auto found = std::lower_bound(begin, end, column);
+        return found != end && *found == column ? values_[found - columnIndices_.begin()] : T(0);
+    }
+};
+
+#endif
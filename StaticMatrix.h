@@ -0,0 +1,256 @@
+#ifndef BAKALARSKAPRACA_STATICMATRIX_H
+#define BAKALARSKAPRACA_STATICMATRIX_H
+
+#include <initializer_list>
+#include <type_traits>
+#include <utility>
+
+/**
+ * Trieda StaticMatrix reprezentuje štvorcovú maticu pevnej veľkosti N známej pri preklade.
+ * Prvky sú uložené priamo v objekte (na zásobníku), takže vytvorenie matice nealokuje pamäť.
+ * Výpočet determinantu je úplne rozvinutý pomocou šablón (všetky indexy sú konštanty pri preklade)
+ * a dá sa použiť aj v constexpr kontexte.
+ *
+ * @tparam T dátový typ prvkov matice
+ * @tparam N stupeň (veľkosť) matice
+ */
+template<class T, int N>
+class StaticMatrix {
+    static_assert(N >= 1, "StaticMatrix requires a positive size.");
+private:
+    T elements_[N][N];      // prvky matice uložené po riadkoch
+public:
+    /**
+     * Konštruktor pre nulovú maticu.
+     */
+    constexpr StaticMatrix() : elements_{} {};
+
+    /**
+     * Konštruktor pre maticu zo zoznamu prvkov uložených po riadkoch (chýbajúce prvky sú 0).
+     *
+     * @param elements prvky matice po riadkoch
+     */
+    constexpr StaticMatrix(std::initializer_list<T> elements) : elements_{} {
+        int index = 0;
+        for (T element : elements) {
+            if (index < N * N) {
+                elements_[index / N][index % N] = element;
+            }
+            index++;
+        }
+    };
+
+    /**
+     * Konštruktor, ktorý skopíruje prvky z ľubovoľného zdroja s prístupom element(riadok, stĺpec),
+     * napr. z pohľadu na podmaticu (MatrixView).
+     *
+     * @tparam F typ zdroja prvkov
+     * @param element zdroj prvkov
+     */
+    template<typename F> requires std::is_invocable_v<const F&, int, int>
+    constexpr explicit StaticMatrix(const F& element) : elements_{} {
+        unroll<N>([&](auto row) {
+            unroll<N>([&](auto column) {
+                elements_[row][column] = element(row, column);
+            });
+        });
+    };
+
+    /**
+     * Getter pre stupeň (veľkosť) matice.
+     *
+     * @return stupeň (veľkosť) matice
+     */
+    static constexpr int getSize() {
+        return N;
+    }
+
+    /**
+     * Operátor () slúži na prístup k prvkom matice.
+     *
+     * @param row index riadku
+     * @param column index stĺpca
+     * @return referencia na prvok
+     */
+    constexpr T& operator()(int row, int column) {
+        return elements_[row][column];
+    }
+
+    /**
+     * Operátor () slúži na čítanie prvkov matice.
+     *
+     * @param row index riadku
+     * @param column index stĺpca
+     * @return hodnota prvku
+     */
+    constexpr T operator()(int row, int column) const {
+        return elements_[row][column];
+    }
+
+    /**
+     * Metóda determinant vypočíta determinant matice.
+     * Matice do stupňa 3 majú uzavretý vzorec (pre stupeň 3 Sarusovo pravidlo), väčšie sa počítajú na kópii:
+     * celočíselné Bareissovým algoritmom (delenia sú presné), ostatné Gaussovou elimináciou s čiastočnou pivotizáciou.
+     *
+     * @return hodnota determinantu
+     */
+    constexpr T determinant() const {
+        const T (&a)[N][N] = elements_;
+        if constexpr (N == 1) {
+            return a[0][0];
+        } else if constexpr (N == 2) {
+            return a[0][0] * a[1][1] - a[0][1] * a[1][0];
+        } else if constexpr (N == 3) {
+            return a[0][0] * a[1][1] * a[2][2]
+                   + a[0][1] * a[1][2] * a[2][0]
+                   + a[0][2] * a[1][0] * a[2][1]
+                   - a[0][2] * a[1][1] * a[2][0]
+                   - a[0][0] * a[1][2] * a[2][1]
+                   - a[0][1] * a[1][0] * a[2][2];
+        } else if constexpr (std::is_integral_v<T>) {
+            StaticMatrix copy = *this;
+            return copy.bareissElimination();
+        } else {
+            StaticMatrix copy = *this;
+            return copy.gaussElimination();
+        }
+    }
+
+private:
+    /**
+     * Metóda unroll zavolá telo pre indexy 0 až Count - 1, index dostane ako konštantu pri preklade (std::integral_constant),
+     * takže cyklus je rozvinutý už prekladačom.
+     *
+     * @tparam Count počet opakovaní
+     * @tparam F typ tela cyklu
+     * @param body telo cyklu
+     */
+    template<int Count, typename F>
+    static constexpr void unroll(F&& body) {
+        [&]<int... I>(std::integer_sequence<int, I...>) {
+            (body(std::integral_constant<int, I>{}), ...);
+        }(std::make_integer_sequence<int, Count>{});
+    }
+
+    /**
+     * Metóda absoluteValue vráti absolútnu hodnotu (constexpr náhrada za std::abs).
+     *
+     * @param value číslo
+     * @return absolútna hodnota
+     */
+    static constexpr T absoluteValue(T value) {
+        return value < 0 ? -value : value;
+    }
+
+    /**
+     * Metóda swapRows vymení riadok K s riadkom pod ním (od stĺpca K). Riadok sa vyberá porovnaním s konštantnými indexmi,
+     * aby sa k prvkom pristupovalo iba konštantnými indexmi a mohli ostať v registroch.
+     *
+     * @tparam K riadok, do ktorého sa presunie pivot
+     * @param pivotRow riadok pivota (väčší ako K)
+     */
+    template<int K>
+    constexpr void swapRows(int pivotRow) {
+        unroll<N - K - 1>([&](auto rowOffset) {
+            constexpr int R = K + 1 + rowOffset;
+            if (R == pivotRow) {
+                unroll<N - K>([&](auto columnOffset) {
+                    constexpr int C = K + columnOffset;
+                    std::swap(elements_[K][C], elements_[R][C]);
+                });
+            }
+        });
+    }
+
+    /**
+     * Metóda gaussElimination vypočíta determinant Gaussovou elimináciou s čiastočnou pivotizáciou (prepíše prvky matice).
+     *
+     * @return hodnota determinantu
+     */
+    constexpr T gaussElimination() {
+        T result = 1;
+        bool singular = false;
+        unroll<N>([&](auto step) {
+            constexpr int K = step;
+            if (singular) {
+                return;
+            }
+            // pivot s najväčšou absolútnou hodnotou v stĺpci K
+            int pivotRow = K;
+            T largest = absoluteValue(elements_[K][K]);
+            unroll<N - K - 1>([&](auto offset) {
+                constexpr int R = K + 1 + offset;
+                if (absoluteValue(elements_[R][K]) > largest) {
+                    largest = absoluteValue(elements_[R][K]);
+                    pivotRow = R;
+                }
+            });
+            if (largest == 0) {
+                singular = true;
+                return;
+            }
+            if (pivotRow != K) {
+                swapRows<K>(pivotRow);
+                result = -result;
+            }
+            T pivot = elements_[K][K];
+            result *= pivot;
+            unroll<N - K - 1>([&](auto rowOffset) {
+                constexpr int R = K + 1 + rowOffset;
+                T factor = elements_[R][K] / pivot;
+                unroll<N - K - 1>([&](auto columnOffset) {
+                    constexpr int C = K + 1 + columnOffset;
+                    elements_[R][C] -= factor * elements_[K][C];
+                });
+            });
+        });
+        return singular ? T(0) : result;
+    }
+
+    /**
+     * Metóda bareissElimination vypočíta determinant celočíselnej matice Bareissovým algoritmom (prepíše prvky matice).
+     * Všetky medzivýsledky sú minory matice, delenia sú preto presné.
+     *
+     * @return hodnota determinantu
+     */
+    constexpr T bareissElimination() {
+        T previousPivot = 1;
+        bool negate = false;
+        bool singular = false;
+        unroll<N - 1>([&](auto step) {
+            constexpr int K = step;
+            if (singular) {
+                return;
+            }
+            if (elements_[K][K] == 0) {
+                int pivotRow = K;
+                unroll<N - K - 1>([&](auto offset) {
+                    constexpr int R = K + 1 + offset;
+                    if (pivotRow == K && elements_[R][K] != 0) {
+                        pivotRow = R;
+                    }
+                });
+                if (pivotRow == K) {
+                    singular = true;
+                    return;
+                }
+                swapRows<K>(pivotRow);
+                negate = !negate;
+            }
+            unroll<N - K - 1>([&](auto rowOffset) {
+                constexpr int R = K + 1 + rowOffset;
+                unroll<N - K - 1>([&](auto columnOffset) {
+                    constexpr int C = K + 1 + columnOffset;
+                    elements_[R][C] = (elements_[R][C] * elements_[K][K] - elements_[R][K] * elements_[K][C]) / previousPivot;
+                });
+            });
+            previousPivot = elements_[K][K];
+        });
+        if (singular) {
+            return 0;
+        }
+        return negate ? -elements_[N - 1][N - 1] : elements_[N - 1][N - 1];
+    }
+};
+
+#endif
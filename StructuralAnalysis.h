@@ -0,0 +1,442 @@
+#ifndef BAKALARSKAPRACA_STRUCTURALANALYSIS_H
+#define BAKALARSKAPRACA_STRUCTURALANALYSIS_H
+
+#include <algorithm>
+#include <limits>
+#include <vector>
+#include "Matrix.h"
+#include "SparseMatrix.h"
+
+/**
+ * Trieda StructuralAnalysis skúma rozloženie nenulových prvkov štvorcovej matice (bez ohľadu na ich hodnoty).
+ * Rozloženie je bipartitný graf: riadok i je spojený so stĺpcom j, ak je prvok (i, j) nenulový. Každý nenulový člen
+ * Leibnitzovho vzorca zodpovedá perfektnému párovaniu tohto grafu, matica bez perfektného párovania je preto
+ * štrukturálne singulárna a jej determinant je 0 pre ľubovoľné hodnoty nenulových prvkov.
+ * Matica s perfektným párovaním sa dá permutáciou riadkov a stĺpcov previesť na blokový trojuholníkový tvar
+ * (Dulmageov-Mendelsohnov rozklad), jej determinant je potom súčin determinantov diagonálnych blokov.
+ */
+class StructuralAnalysis {
+private:
+    static constexpr int UNMATCHED = -1;                        // riadok alebo stĺpec bez páru
+    static constexpr int INFINITE_DISTANCE = std::numeric_limits<int>::max();    // vzdialenosť riadku mimo vrstiev hľadania
+
+    int size_;                      // stupeň matice
+    std::vector<int> rowStarts_;    // index prvého stĺpca každého riadku v zozname stĺpcov (size + 1 prvkov)
+    std::vector<int> columns_;      // stĺpce nenulových prvkov po riadkoch
+    std::vector<int> rowMatches_;   // stĺpec spárovaný s riadkom (UNMATCHED, ak riadok nemá pár)
+    std::vector<int> columnMatches_;    // riadok spárovaný so stĺpcom (UNMATCHED, ak stĺpec nemá pár)
+    int matchingSize_;              // počet párov maximálneho párovania (-1, ak ešte nebolo vypočítané)
+public:
+    /**
+     * Konštruktor, ktorý zostaví graf nenulových prvkov hustej matice (O(n^2)).
+     *
+     * @tparam T dátový typ prvkov matice
+     * @param matrix referencia na maticu
+     */
+    template<typename T>
+    explicit StructuralAnalysis(Matrix<T>& matrix) : size_(matrix.getSize()), rowStarts_(matrix.getSize() + 1, 0), matchingSize_(-1) {
+        for (int i = 0; i < size_; ++i) {
+            for (int j = 0; j < size_; ++j) {
+                if (matrix[i][j] != 0) {
+                    columns_.push_back(j);
+                }
+            }
+            rowStarts_[i + 1] = static_cast<int>(columns_.size());
+        }
+    }
+
+    /**
+     * Konštruktor, ktorý zostaví graf nenulových prvkov riedkej matice (O(nnz)).
+     *
+     * @tparam T dátový typ prvkov matice
+     * @param matrix referencia na riedku maticu
+     */
+    template<typename T>
+    explicit StructuralAnalysis(const SparseMatrix<T>& matrix) : size_(matrix.getSize()), rowStarts_(matrix.getSize() + 1, 0), matchingSize_(-1) {
+        for (int i = 0; i < size_; ++i) {
+            for (int k = matrix.getRowStarts()[i]; k < matrix.getRowStarts()[i + 1]; ++k) {
+                if (matrix.getValues()[k] != 0) {
+                    columns_.push_back(matrix.getColumnIndices()[k]);
+                }
+            }
+            rowStarts_[i + 1] = static_cast<int>(columns_.size());
+        }
+    }
+
+    /**
+     * Metóda isStructurallySingular zistí, či graf nenulových prvkov nemá perfektné párovanie
+     * (determinant matice je potom 0 bez ohľadu na hodnoty prvkov).
+     *
+     * @return či je matica štrukturálne singulárna (boolean)
+     */
+    bool isStructurallySingular() {
+        return getMatchingSize() < size_;
+    }
+
+    /**
+     * Metóda getMatchingSize vráti veľkosť maximálneho párovania riadkov a stĺpcov (štrukturálnu hodnosť matice).
+     * Párovanie sa vypočíta pri prvom volaní Hopcroftovým-Karpovým algoritmom v čase O(nnz * sqrt(n)).
+     *
+     * @return počet párov maximálneho párovania
+     */
+    int getMatchingSize() {
+        if (matchingSize_ < 0) {
+            computeMaximumMatching();
+        }
+        return matchingSize_;
+    }
+
+    /**
+     * Getter pre stĺpce spárované s riadkami maximálneho párovania.
+     *
+     * @return stĺpec spárovaný s každým riadkom (-1, ak riadok nemá pár)
+     */
+    const std::vector<int>& getRowMatches() {
+        getMatchingSize();
+        return rowMatches_;
+    }
+
+    /**
+     * Metóda getBlockTriangularForm nájde permutácie riadkov a stĺpcov, po ktorých je matica blokovo dolná trojuholníková
+     * s nerozložiteľnými diagonálnymi blokmi. Stĺpec spárovaný s riadkom sa presunie na diagonálu, riadok i je potom
+     * v grafe spojený s riadkom k, ak je nenulový prvok v riadku i a stĺpci spárovanom s k. Bloky sú silne súvislé komponenty
+     * tohto grafu (Tarjanov algoritmus bez rekurzie, O(nnz)), ktoré sa vydávajú až po všetkých komponentoch dosiahnuteľných
+     * z nich, takže nenulové prvky mimo blokov ležia pod diagonálou blokov.
+     * Permutovaná matica má prvky B[p][q] = A[rowOrder[p]][columnOrder[q]] a det A = sign * det B.
+     *
+     * @param rowOrder výstup: poradie riadkov
+     * @param columnOrder výstup: poradie stĺpcov
+     * @param blockStarts výstup: začiatky blokov (blok b zaberá pozície blockStarts[b] až blockStarts[b + 1] - 1)
+     * @return znamienko permutácií (1 alebo -1), 0 ak je matica štrukturálne singulárna (tvar sa nevytvorí)
+     */
+    int getBlockTriangularForm(std::vector<int>& rowOrder, std::vector<int>& columnOrder, std::vector<int>& blockStarts) {
+        rowOrder.clear();
+        columnOrder.clear();
+        blockStarts.assign(1, 0);
+        if (isStructurallySingular()) {
+            return 0;
+        }
+        std::vector<int> indices(size_, UNMATCHED);     // poradie objavenia riadku (UNMATCHED pre neobjavené riadky)
+        std::vector<int> lowLinks(size_);
+        std::vector<int> nextEdges(size_);
+        std::vector<char> onStack(size_, 0);
+        std::vector<int> callStack;
+        std::vector<int> componentStack;
+        int counter = 0;
+        for (int root = 0; root < size_; ++root) {
+            if (indices[root] != UNMATCHED) {
+                continue;
+            }
+            indices[root] = lowLinks[root] = counter++;
+            nextEdges[root] = rowStarts_[root];
+            callStack.push_back(root);
+            componentStack.push_back(root);
+            onStack[root] = 1;
+            while (!callStack.empty()) {
+                int row = callStack.back();
+                if (nextEdges[row] < rowStarts_[row + 1]) {
+                    int next = columnMatches_[columns_[nextEdges[row]++]];
+                    if (indices[next] == UNMATCHED) {
+                        indices[next] = lowLinks[next] = counter++;
+                        nextEdges[next] = rowStarts_[next];
+                        callStack.push_back(next);
+                        componentStack.push_back(next);
+                        onStack[next] = 1;
+                    } else if (onStack[next]) {
+                        lowLinks[row] = std::min(lowLinks[row], indices[next]);
+                    }
+                    continue;
+                }
+                callStack.pop_back();
+                if (!callStack.empty()) {
+                    lowLinks[callStack.back()] = std::min(lowLinks[callStack.back()], lowLinks[row]);
+                }
+                if (lowLinks[row] == indices[row]) {
+                    // riadok je koreňom komponentu, komponent tvoria riadky nad ním v zásobníku
+                    int member;
+                    do {
+                        member = componentStack.back();
+                        componentStack.pop_back();
+                        onStack[member] = 0;
+                        rowOrder.push_back(member);
+                        columnOrder.push_back(rowMatches_[member]);
+                    } while (member != row);
+                    blockStarts.push_back(static_cast<int>(rowOrder.size()));
+                }
+            }
+        }
+        return permutationSign(rowOrder) * permutationSign(columnOrder);
+    }
+
+    /**
+     * Metóda getBandwidthReducingOrder nájde symetrickú permutáciu riadkov a stĺpcov, ktorá zmenšuje šírku pásma matice
+     * (obrátený Cuthillov-McKeeho algoritmus). Rozloženie sa symetrizuje (A + A^T), každý komponent grafu sa prehľadá
+     * do šírky od pseudo-periférneho vrcholu, susedia sa pridávajú vzostupne podľa stupňa a výsledné poradie sa obráti.
+     *
+     * @return nové poradie riadkov a stĺpcov (prvok p je pôvodný index p-teho riadku a stĺpca)
+     */
+    std::vector<int> getBandwidthReducingOrder() const {
+        // symetrizovaný graf bez slučiek, susedia každého vrcholu bez opakovania
+        std::vector<int> degrees(size_ + 1, 0);
+        for (int row = 0; row < size_; ++row) {
+            for (int k = rowStarts_[row]; k < rowStarts_[row + 1]; ++k) {
+                if (columns_[k] != row) {
+                    degrees[row + 1]++;
+                    degrees[columns_[k] + 1]++;
+                }
+            }
+        }
+        std::vector<int> neighbourStarts(size_ + 1, 0);
+        for (int vertex = 0; vertex < size_; ++vertex) {
+            neighbourStarts[vertex + 1] = neighbourStarts[vertex] + degrees[vertex + 1];
+        }
+        std::vector<int> neighbours(neighbourStarts[size_]);
+        std::vector<int> fill(neighbourStarts.begin(), neighbourStarts.end() - 1);
+        for (int row = 0; row < size_; ++row) {
+            for (int k = rowStarts_[row]; k < rowStarts_[row + 1]; ++k) {
+                if (columns_[k] != row) {
+                    neighbours[fill[row]++] = columns_[k];
+                    neighbours[fill[columns_[k]]++] = row;
+                }
+            }
+        }
+        for (int vertex = 0; vertex < size_; ++vertex) {
+            auto begin = neighbours.begin() + neighbourStarts[vertex];
+            auto end = neighbours.begin() + fill[vertex];
+            std::sort(begin, end);
+            fill[vertex] = static_cast<int>(std::unique(begin, end) - neighbours.begin());
+            degrees[vertex] = fill[vertex] - neighbourStarts[vertex];
+        }
+        degrees.pop_back();
+
+        std::vector<int> verticesByDegree(size_);
+        for (int vertex = 0; vertex < size_; ++vertex) {
+            verticesByDegree[vertex] = vertex;
+        }
+        std::stable_sort(verticesByDegree.begin(), verticesByDegree.end(), [&](int first, int second) {
+            return degrees[first] < degrees[second];
+        });
+
+        std::vector<int> order;
+        order.reserve(size_);
+        std::vector<int> levels(size_, UNMATCHED);      // úroveň vrcholu v poslednom prehľadávaní (UNMATCHED pre nedosiahnuté)
+        std::vector<char> ordered(size_, 0);
+        std::vector<int> component;
+        for (int candidate : verticesByDegree) {
+            if (ordered[candidate]) {
+                continue;
+            }
+            // pseudo-periférny vrchol: kým sa výstrednosť zväčšuje, prejde sa na vrchol najmenšieho stupňa v poslednej úrovni
+            int root = candidate;
+            int eccentricity = breadthFirstLevels(root, neighbours, neighbourStarts, fill, levels, component);
+            while (true) {
+                int next = root;
+                for (int i = static_cast<int>(component.size()) - 1; i >= 0 && levels[component[i]] == eccentricity; --i) {
+                    if (next == root || degrees[component[i]] < degrees[next]) {
+                        next = component[i];
+                    }
+                }
+                int nextEccentricity = breadthFirstLevels(next, neighbours, neighbourStarts, fill, levels, component);
+                if (nextEccentricity <= eccentricity) {
+                    break;
+                }
+                root = next;
+                eccentricity = nextEccentricity;
+            }
+
+            // Cuthillovo-McKeeho poradie komponentu: prehľadávanie do šírky, susedia vzostupne podľa stupňa
+            std::size_t head = order.size();
+            order.push_back(root);
+            ordered[root] = 1;
+            while (head < order.size()) {
+                int vertex = order[head++];
+                std::size_t firstNew = order.size();
+                for (int k = neighbourStarts[vertex]; k < fill[vertex]; ++k) {
+                    if (!ordered[neighbours[k]]) {
+                        ordered[neighbours[k]] = 1;
+                        order.push_back(neighbours[k]);
+                    }
+                }
+                std::stable_sort(order.begin() + firstNew, order.end(), [&](int first, int second) {
+                    return degrees[first] < degrees[second];
+                });
+            }
+            for (int vertex : component) {
+                levels[vertex] = UNMATCHED;
+            }
+        }
+        std::reverse(order.begin(), order.end());
+        return order;
+    }
+
+private:
+    /**
+     * Metóda breadthFirstLevels rozdelí vrcholy komponentu do úrovní prehľadávaním do šírky z koreňa.
+     * Úrovne predchádzajúceho prehľadávania (vrcholy v component) sa najskôr zmažú.
+     *
+     * @param root koreň prehľadávania
+     * @param neighbours susedia vrcholov symetrizovaného grafu
+     * @param neighbourStarts index prvého suseda každého vrcholu
+     * @param neighbourEnds index za posledným susedom každého vrcholu
+     * @param levels výstup: úrovne vrcholov komponentu
+     * @param component výstup: vrcholy komponentu v poradí prehľadávania
+     * @return výstrednosť koreňa (najvyššia úroveň)
+     */
+    static int breadthFirstLevels(int root, const std::vector<int>& neighbours, const std::vector<int>& neighbourStarts, const std::vector<int>& neighbourEnds,
+                                  std::vector<int>& levels, std::vector<int>& component) {
+        for (int vertex : component) {
+            levels[vertex] = UNMATCHED;
+        }
+        component.assign(1, root);
+        levels[root] = 0;
+        for (std::size_t head = 0; head < component.size(); ++head) {
+            int vertex = component[head];
+            for (int k = neighbourStarts[vertex]; k < neighbourEnds[vertex]; ++k) {
+                if (levels[neighbours[k]] == UNMATCHED) {
+                    levels[neighbours[k]] = levels[vertex] + 1;
+                    component.push_back(neighbours[k]);
+                }
+            }
+        }
+        return levels[component.back()];
+    }
+
+    /**
+     * Metóda permutationSign vráti znamienko permutácie podľa počtu jej cyklov párnej dĺžky.
+     *
+     * @param permutation permutácia čísel 0 až n - 1
+     * @return znamienko permutácie (1 alebo -1)
+     */
+    static int permutationSign(const std::vector<int>& permutation) {
+        std::vector<char> visited(permutation.size(), 0);
+        int sign = 1;
+        for (std::size_t start = 0; start < permutation.size(); ++start) {
+            if (visited[start]) {
+                continue;
+            }
+            std::size_t length = 0;
+            for (std::size_t position = start; !visited[position]; position = permutation[position]) {
+                visited[position] = 1;
+                length++;
+            }
+            if (length % 2 == 0) {
+                sign = -sign;
+            }
+        }
+        return sign;
+    }
+
+    /**
+     * Metóda computeMaximumMatching nájde maximálne párovanie Hopcroftovým-Karpovým algoritmom. Po počiatočnom
+     * hladnom párovaní sa opakovane rozdelia riadky do vrstiev prehľadávaním do šírky od voľných riadkov a pozdĺž vrstiev
+     * sa nájde maximálna množina disjunktných zlepšujúcich ciest. Stačí O(sqrt(n)) fáz, každá trvá O(nnz).
+     */
+    void computeMaximumMatching() {
+        rowMatches_.assign(size_, UNMATCHED);
+        columnMatches_.assign(size_, UNMATCHED);
+        matchingSize_ = 0;
+        for (int row = 0; row < size_; ++row) {
+            for (int k = rowStarts_[row]; k < rowStarts_[row + 1]; ++k) {
+                if (columnMatches_[columns_[k]] == UNMATCHED) {
+                    rowMatches_[row] = columns_[k];
+                    columnMatches_[columns_[k]] = row;
+                    matchingSize_++;
+                    break;
+                }
+            }
+        }
+
+        std::vector<int> distances(size_);
+        std::vector<int> nextEdges(size_);
+        std::vector<int> queue(size_);
+        std::vector<int> stack;
+        while (matchingSize_ < size_ && layerRows(distances, queue)) {
+            for (int row = 0; row < size_; ++row) {
+                nextEdges[row] = rowStarts_[row];
+            }
+            for (int row = 0; row < size_; ++row) {
+                if (rowMatches_[row] == UNMATCHED && augmentFrom(row, distances, nextEdges, stack)) {
+                    matchingSize_++;
+                }
+            }
+        }
+    }
+
+    /**
+     * Metóda layerRows rozdelí riadky do vrstiev prehľadávaním do šírky: voľné riadky majú vzdialenosť 0,
+     * riadok spárovaný so stĺpcom susediacim s riadkom vo vrstve d má vzdialenosť d + 1.
+     *
+     * @param distances výstup: vzdialenosti riadkov (INFINITE_DISTANCE pre nedosiahnuté riadky)
+     * @param queue pamäť pre frontu riadkov (size prvkov)
+     * @return či existuje zlepšujúca cesta (niektorý dosiahnutý stĺpec je voľný)
+     */
+    bool layerRows(std::vector<int>& distances, std::vector<int>& queue) {
+        int head = 0;
+        int tail = 0;
+        for (int row = 0; row < size_; ++row) {
+            if (rowMatches_[row] == UNMATCHED) {
+                distances[row] = 0;
+                queue[tail++] = row;
+            } else {
+                distances[row] = INFINITE_DISTANCE;
+            }
+        }
+        bool found = false;
+        while (head < tail) {
+            int row = queue[head++];
+            for (int k = rowStarts_[row]; k < rowStarts_[row + 1]; ++k) {
+                int matchedRow = columnMatches_[columns_[k]];
+                if (matchedRow == UNMATCHED) {
+                    found = true;
+                } else if (distances[matchedRow] == INFINITE_DISTANCE) {
+                    distances[matchedRow] = distances[row] + 1;
+                    queue[tail++] = matchedRow;
+                }
+            }
+        }
+        return found;
+    }
+
+    /**
+     * Metóda augmentFrom hľadá z voľného riadku zlepšujúcu cestu pozdĺž vrstiev (do hĺbky, bez rekurzie)
+     * a ak ju nájde, vymení pozdĺž nej spárované a nespárované hrany. Riadky, z ktorých cesta nevedie, sa vyradia z vrstiev.
+     *
+     * @param root voľný riadok
+     * @param distances vzdialenosti riadkov
+     * @param nextEdges index ďalšej neskúmanej hrany každého riadku
+     * @param stack pamäť pre zásobník riadkov cesty
+     * @return či sa našla zlepšujúca cesta (boolean)
+     */
+    bool augmentFrom(int root, std::vector<int>& distances, std::vector<int>& nextEdges, std::vector<int>& stack) {
+        stack.assign(1, root);
+        while (!stack.empty()) {
+            int row = stack.back();
+            if (nextEdges[row] == rowStarts_[row + 1]) {
+                distances[row] = INFINITE_DISTANCE;
+                stack.pop_back();
+                if (!stack.empty()) {
+                    nextEdges[stack.back()]++;
+                }
+                continue;
+            }
+            int matchedRow = columnMatches_[columns_[nextEdges[row]]];
+            if (matchedRow == UNMATCHED) {
+                // každý riadok na zásobníku sa spáruje so stĺpcom, cez ktorý cesta pokračuje
+                for (int pathRow : stack) {
+                    int column = columns_[nextEdges[pathRow]];
+                    rowMatches_[pathRow] = column;
+                    columnMatches_[column] = pathRow;
+                }
+                return true;
+            }
+            if (distances[matchedRow] == distances[row] + 1) {
+                stack.push_back(matchedRow);
+            } else {
+                nextEdges[row]++;
+            }
+        }
+        return false;
+    }
+};
+
+#endif
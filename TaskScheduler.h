@@ -0,0 +1,371 @@
+#ifndef BAKALARSKAPRACA_TASKSCHEDULER_H
+#define BAKALARSKAPRACA_TASKSCHEDULER_H
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+/**
+ * Štruktúra Task reprezentuje jednu úlohu grafu závislostí.
+ */
+struct Task {
+    std::function<void()> work;             // práca úlohy
+    int type;                               // typ úlohy (index do štatistík grafu)
+    std::atomic<int> dependencies;          // počet nedokončených predchodcov
+    std::vector<Task*> successors;          // úlohy, ktoré čakajú na túto úlohu
+
+    Task(int taskType, std::function<void()> taskWork) : work(std::move(taskWork)), type(taskType), dependencies(0) {};
+};
+
+/**
+ * Trieda TaskGraph uchováva úlohy, závislosti medzi nimi a štatistiky trvania úloh podľa typu.
+ * Úlohy je možné pridávať aj počas vykonávania grafu (z inej úlohy), závislosti iba pred jeho spustením.
+ */
+class TaskGraph {
+private:
+    /**
+     * Štruktúra TaskStatistics uchováva súhrnné trvanie úloh jedného typu.
+     */
+    struct TaskStatistics {
+        std::string name;                               // názov typu úlohy
+        std::atomic<long long> count{0};                // počet vykonaných úloh
+        std::atomic<long long> totalNanoseconds{0};     // súčet trvania úloh v nanosekundách
+        std::atomic<long long> maxNanoseconds{0};       // najdlhšie trvanie jednej úlohy v nanosekundách
+    };
+
+    std::deque<Task> tasks_;                                    // úlohy (deque nemení adresy pri pridávaní)
+    std::mutex mutex_;                                          // zámok pre pridávanie úloh
+    std::vector<std::unique_ptr<TaskStatistics>> statistics_;   // štatistiky podľa typu úlohy
+    std::atomic<int> unfinishedTasks_;                          // počet nedokončených úloh
+public:
+    /**
+     * Konštruktor grafu.
+     *
+     * @param typeNames názvy typov úloh (typ úlohy je index do tohto zoznamu)
+     */
+    explicit TaskGraph(const std::vector<std::string>& typeNames) : unfinishedTasks_(0) {
+        for (const std::string& name : typeNames) {
+            statistics_.push_back(std::make_unique<TaskStatistics>());
+            statistics_.back()->name = name;
+        }
+    }
+
+    /**
+     * Metóda addTask pridá do grafu novú úlohu.
+     *
+     * @param type typ úlohy
+     * @param work práca úlohy
+     * @return ukazovateľ na úlohu
+     */
+    Task* addTask(int type, std::function<void()> work) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        unfinishedTasks_.fetch_add(1, std::memory_order_relaxed);
+        return &tasks_.emplace_back(type, std::move(work));
+    }
+
+    /**
+     * Metóda addDependency nastaví, že úloha after môže začať až po dokončení úlohy before.
+     *
+     * @param before predchodca
+     * @param after nasledovník
+     */
+    void addDependency(Task* before, Task* after) {
+        before->successors.push_back(after);
+        after->dependencies.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    /**
+     * Metóda getReadyTasks vráti úlohy, ktoré nečakajú na žiadneho predchodcu.
+     *
+     * @return pripravené úlohy
+     */
+    std::vector<Task*> getReadyTasks() {
+        std::vector<Task*> ready;
+        std::lock_guard<std::mutex> lock(mutex_);
+        for (Task& task : tasks_) {
+            if (task.dependencies.load(std::memory_order_relaxed) == 0) {
+                ready.push_back(&task);
+            }
+        }
+        return ready;
+    }
+
+    /**
+     * Metóda recordTime zaznamená trvanie vykonanej úlohy.
+     *
+     * @param type typ úlohy
+     * @param nanoseconds trvanie v nanosekundách
+     */
+    void recordTime(int type, long long nanoseconds) {
+        TaskStatistics& statistics = *statistics_[type];
+        statistics.count.fetch_add(1, std::memory_order_relaxed);
+        statistics.totalNanoseconds.fetch_add(nanoseconds, std::memory_order_relaxed);
+        long long previous = statistics.maxNanoseconds.load(std::memory_order_relaxed);
+        while (previous < nanoseconds && !statistics.maxNanoseconds.compare_exchange_weak(previous, nanoseconds, std::memory_order_relaxed)) {
+        }
+    }
+
+    /**
+     * Metóda finishTask označí úlohu za dokončenú.
+     *
+     * @return či boli dokončené všetky úlohy grafu (boolean)
+     */
+    bool finishTask() {
+        return unfinishedTasks_.fetch_sub(1, std::memory_order_acq_rel) == 1;
+    }
+
+    /**
+     * Metóda isFinished zistí, či boli dokončené všetky úlohy grafu.
+     *
+     * @return či boli dokončené všetky úlohy (boolean)
+     */
+    bool isFinished() const {
+        return unfinishedTasks_.load(std::memory_order_acquire) == 0;
+    }
+
+    /**
+     * Metóda getTimingReport vráti prehľad trvania úloh podľa typu.
+     *
+     * @return prehľad po riadkoch: názov, počet úloh, celkové, priemerné a najdlhšie trvanie v sekundách
+     */
+    std::string getTimingReport() const {
+        std::string report;
+        for (const std::unique_ptr<TaskStatistics>& statistics : statistics_) {
+            long long count = statistics->count.load();
+            double total = statistics->totalNanoseconds.load() * 1e-9;
+            report += statistics->name + ": " + std::to_string(count) + " tasks, total " + std::to_string(total) + "s, average "
+                      + std::to_string(count > 0 ? total / count : 0.0) + "s, max " + std::to_string(statistics->maxNanoseconds.load() * 1e-9) + "s\n";
+        }
+        return report;
+    }
+};
+
+/**
+ * Trieda WorkStealingScheduler vykonáva graf úloh na perzistentných vláknach.
+ * Každé vlákno má vlastný zásobník pripravených úloh, z ktorého berie naposledy pridané úlohy (LIFO),
+ * a keď je prázdny, kradne najstaršie úlohy zo zásobníkov ostatných vlákien (FIFO).
+ * Úloha, ktorá sa stane pripravenou po dokončení predchodcu, sa pridá do zásobníka vlákna, ktoré predchodcu dokončilo.
+ */
+class WorkStealingScheduler {
+private:
+    /**
+     * Štruktúra WorkerQueue reprezentuje zásobník pripravených úloh jedného vlákna.
+     */
+    struct WorkerQueue {
+        std::mutex mutex;           // zámok zásobníka
+        std::deque<Task*> tasks;    // pripravené úlohy
+    };
+
+    std::vector<std::thread> workers_;                      // pomocné vlákna (volajúce vlákno má index 0)
+    std::vector<std::unique_ptr<WorkerQueue>> queues_;      // zásobníky úloh jednotlivých vlákien
+    std::mutex mutex_;                                      // zámok pre uspávanie vlákien
+    std::condition_variable wakeUp_;                        // prebudenie vlákien pri novom grafe alebo ukončení
+    TaskGraph* graph_;                                      // aktuálne vykonávaný graf
+    unsigned int generation_;                               // poradové číslo vykonávaného grafu
+    std::atomic<int> activeWorkers_;                        // počet pomocných vlákien, ktoré pracujú na grafe
+    bool stop_;                                             // či sa majú vlákna ukončiť
+
+    /**
+     * Metóda currentWorker vráti index vlákna v rámci plánovača (-1 pre vlákno mimo plánovača).
+     *
+     * @return referencia na index vlákna
+     */
+    static int& currentWorker() {
+        thread_local int index = -1;
+        return index;
+    }
+public:
+    /**
+     * Konštruktor vytvorí pomocné vlákna.
+     *
+     * @param threadCount celkový počet vlákien vrátane volajúceho (aspoň 1)
+     */
+    explicit WorkStealingScheduler(int threadCount) : graph_(nullptr), generation_(0), activeWorkers_(0), stop_(false) {
+        threadCount = std::max(threadCount, 1);
+        for (int i = 0; i < threadCount; ++i) {
+            queues_.push_back(std::make_unique<WorkerQueue>());
+        }
+        for (int i = 1; i < threadCount; ++i) {
+            workers_.emplace_back([this, i] { workerLoop(i); });
+        }
+    }
+
+    WorkStealingScheduler(const WorkStealingScheduler&) = delete;
+    WorkStealingScheduler& operator=(const WorkStealingScheduler&) = delete;
+
+    /**
+     * Deštruktor ukončí a počká na všetky pomocné vlákna.
+     */
+    ~WorkStealingScheduler() {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stop_ = true;
+        }
+        wakeUp_.notify_all();
+        for (std::thread& worker : workers_) {
+            worker.join();
+        }
+    }
+
+    /**
+     * Getter pre celkový počet vlákien vrátane volajúceho.
+     *
+     * @return počet vlákien
+     */
+    int getThreadCount() const {
+        return static_cast<int>(queues_.size());
+    }
+
+    /**
+     * Metóda execute vykoná všetky úlohy grafu a počká na ich dokončenie. Volajúce vlákno pracuje ako vlákno 0.
+     *
+     * @param graph graf úloh
+     */
+    void execute(TaskGraph& graph) {
+        if (graph.isFinished()) {
+            return;
+        }
+        std::vector<Task*> ready = graph.getReadyTasks();
+        // počiatočné úlohy sa rozdelia medzi zásobníky všetkých vlákien
+        for (std::size_t i = 0; i < ready.size(); ++i) {
+            WorkerQueue& queue = *queues_[i % queues_.size()];
+            std::lock_guard<std::mutex> lock(queue.mutex);
+            queue.tasks.push_back(ready[i]);
+        }
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            graph_ = &graph;
+            generation_++;
+            activeWorkers_.store(static_cast<int>(workers_.size()), std::memory_order_relaxed);
+        }
+        wakeUp_.notify_all();
+        currentWorker() = 0;
+        runTasks(graph, 0);
+        currentWorker() = -1;
+        // graf je dokončený až keď ho opustia všetky pomocné vlákna
+        while (activeWorkers_.load(std::memory_order_acquire) != 0) {
+            std::this_thread::yield();
+        }
+    }
+
+    /**
+     * Metóda spawn pridá novú úlohu (bez závislostí) počas vykonávania grafu do zásobníka aktuálneho vlákna.
+     *
+     * @param task úloha vytvorená metódou TaskGraph::addTask
+     */
+    void spawn(Task* task) {
+        int worker = std::max(currentWorker(), 0);
+        std::lock_guard<std::mutex> lock(queues_[worker]->mutex);
+        queues_[worker]->tasks.push_back(task);
+    }
+
+    /**
+     * Metóda getCurrentWorker vráti index vlákna plánovača, ktoré vykonáva aktuálnu úlohu (0 pre volajúce vlákno).
+     *
+     * @return index vlákna
+     */
+    static int getCurrentWorker() {
+        return std::max(currentWorker(), 0);
+    }
+
+private:
+    /**
+     * Metóda workerLoop predstavuje cyklus pomocného vlákna: čaká na nový graf a pracuje na ňom, kým nie je dokončený.
+     *
+     * @param index index vlákna
+     */
+    void workerLoop(int index) {
+        currentWorker() = index;
+        unsigned int seenGeneration = 0;
+        while (true) {
+            TaskGraph* graph;
+            {
+                std::unique_lock<std::mutex> lock(mutex_);
+                wakeUp_.wait(lock, [&] { return generation_ != seenGeneration || stop_; });
+                if (stop_) {
+                    return;
+                }
+                seenGeneration = generation_;
+                graph = graph_;
+            }
+            runTasks(*graph, index);
+            activeWorkers_.fetch_sub(1, std::memory_order_acq_rel);
+        }
+    }
+
+    /**
+     * Metóda runTasks vykonáva úlohy z vlastného zásobníka alebo ukradnuté úlohy, kým nie je graf dokončený.
+     *
+     * @param graph graf úloh
+     * @param index index vlákna
+     */
+    void runTasks(TaskGraph& graph, int index) {
+        int threadCount = static_cast<int>(queues_.size());
+        while (!graph.isFinished()) {
+            Task* task = popTask(index);
+            for (int offset = 1; task == nullptr && offset < threadCount; ++offset) {
+                task = stealTask((index + offset) % threadCount);
+            }
+            if (task == nullptr) {
+                std::this_thread::yield();
+                continue;
+            }
+
+            auto start = std::chrono::steady_clock::now();
+            task->work();
+            auto end = std::chrono::steady_clock::now();
+            graph.recordTime(task->type, std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count());
+
+            // nasledovníci, ktorí už nečakajú na žiadnu úlohu, sa pridajú do vlastného zásobníka
+            for (Task* successor : task->successors) {
+                if (successor->dependencies.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+                    std::lock_guard<std::mutex> lock(queues_[index]->mutex);
+                    queues_[index]->tasks.push_back(successor);
+                }
+            }
+            graph.finishTask();
+        }
+    }
+
+    /**
+     * Metóda popTask vyberie naposledy pridanú úlohu z vlastného zásobníka.
+     *
+     * @param index index vlákna
+     * @return úloha alebo nullptr, ak je zásobník prázdny
+     */
+    Task* popTask(int index) {
+        std::lock_guard<std::mutex> lock(queues_[index]->mutex);
+        if (queues_[index]->tasks.empty()) {
+            return nullptr;
+        }
+        Task* task = queues_[index]->tasks.back();
+        queues_[index]->tasks.pop_back();
+        return task;
+    }
+
+    /**
+     * Metóda stealTask ukradne najstaršiu úlohu zo zásobníka iného vlákna.
+     *
+     * @param victim index vlákna, ktorému sa úloha kradne
+     * @return úloha alebo nullptr, ak je zásobník prázdny
+     */
+    Task* stealTask(int victim) {
+        std::lock_guard<std::mutex> lock(queues_[victim]->mutex);
+        if (queues_[victim]->tasks.empty()) {
+            return nullptr;
+        }
+        Task* task = queues_[victim]->tasks.front();
+        queues_[victim]->tasks.pop_front();
+        return task;
+    }
+};
+
+#endif
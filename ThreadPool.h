@@ -0,0 +1,170 @@
+#ifndef BAKALARSKAPRACA_THREADPOOL_H
+#define BAKALARSKAPRACA_THREADPOOL_H
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+/**
+ * Trieda ThreadPool predstavuje skupinu vlákien, ktoré sa vytvoria raz a čakajú na ďalšiu úlohu.
+ * Úlohu vykonávajú všetky vlákna naraz (vrátane volajúceho vlákna), volajúci počká na jej dokončenie.
+ * Vlákna po dokončení úlohy krátko aktívne čakajú na ďalšiu, aby krátke úlohy nasledujúce rýchlo po sebe
+ * (napr. úprava riadkov pre každý pivot) neplatili za uspanie a prebudenie vlákna.
+ */
+class ThreadPool {
+private:
+    static constexpr int SPIN_ITERATIONS = 4096;     // počet pokusov aktívneho čakania pred uspaním vlákna
+
+    std::vector<std::thread> workers_;              // pomocné vlákna (volajúce vlákno sa do počtu ráta tiež)
+    std::mutex mutex_;                              // zámok pre uspávanie vlákien
+    std::condition_variable wakeUp_;                // prebudenie vlákien pri novej úlohe alebo ukončení
+    const std::function<void(int)>* job_;           // aktuálna úloha, dostane index vlákna
+    std::atomic<unsigned int> generation_;          // poradové číslo aktuálnej úlohy
+    std::atomic<int> remaining_;                    // počet pomocných vlákien, ktoré ešte nedokončili úlohu
+    std::atomic<bool> stop_;                        // či sa majú vlákna ukončiť
+public:
+    /**
+     * Konštruktor vytvorí pomocné vlákna.
+     *
+     * @param threadCount celkový počet vlákien vrátane volajúceho (aspoň 1)
+     */
+    explicit ThreadPool(int threadCount) : job_(nullptr), generation_(0), remaining_(0), stop_(false) {
+        for (int i = 1; i < std::max(threadCount, 1); ++i) {
+            workers_.emplace_back([this, i] { workerLoop(i); });
+        }
+    }
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    /**
+     * Deštruktor ukončí a počká na všetky pomocné vlákna.
+     */
+    ~ThreadPool() {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stop_ = true;
+        }
+        wakeUp_.notify_all();
+        for (std::thread& worker : workers_) {
+            worker.join();
+        }
+    }
+
+    /**
+     * Getter pre celkový počet vlákien vrátane volajúceho.
+     *
+     * @return počet vlákien
+     */
+    int getThreadCount() const {
+        return static_cast<int>(workers_.size()) + 1;
+    }
+
+    /**
+     * Metóda run vykoná úlohu na všetkých vláknach a počká na jej dokončenie.
+     * Volajúce vlákno má index 0, pomocné vlákna indexy 1 až getThreadCount() - 1.
+     *
+     * @param job úloha, ktorá dostane index vlákna
+     */
+    void run(const std::function<void(int)>& job) {
+        if (workers_.empty()) {
+            job(0);
+            return;
+        }
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            job_ = &job;
+            remaining_.store(static_cast<int>(workers_.size()), std::memory_order_relaxed);
+            generation_.fetch_add(1, std::memory_order_release);
+        }
+        wakeUp_.notify_all();
+        job(0);
+        for (int spin = 0; remaining_.load(std::memory_order_acquire) != 0; ++spin) {
+            if (spin > SPIN_ITERATIONS) {
+                std::this_thread::yield();
+            }
+        }
+    }
+
+    /**
+     * Metóda parallelFor rozdelí interval [begin, end) na súvislé časti rovnakej veľkosti, jednu pre každé vlákno.
+     *
+     * @tparam F typ funkcie
+     * @param begin začiatok intervalu
+     * @param end koniec intervalu
+     * @param body funkcia, ktorá dostane časť intervalu (chunkBegin, chunkEnd), prípadne aj index vlákna (chunkBegin, chunkEnd, thread)
+     */
+    template<typename F>
+    void parallelFor(int begin, int end, F&& body) {
+        int threadCount = std::min(getThreadCount(), std::max(end - begin, 1));
+        std::function<void(int)> job = [&](int thread) {
+            if (thread >= threadCount) {
+                return;
+            }
+            long long length = end - begin;
+            int chunkBegin = begin + static_cast<int>(length * thread / threadCount);
+            int chunkEnd = begin + static_cast<int>(length * (thread + 1) / threadCount);
+            if (chunkBegin < chunkEnd) {
+                if constexpr (std::is_invocable_v<F&, int, int, int>) {
+                    body(chunkBegin, chunkEnd, thread);
+                } else {
+                    body(chunkBegin, chunkEnd);
+                }
+            }
+        };
+        run(job);
+    }
+
+    /**
+     * Metóda parallelForDynamic rozdeľuje indexy 0 až count - 1 vláknam postupne (vlákno si vždy vezme ďalší voľný index),
+     * čo je vhodné pre časti s veľmi rozdielnou dĺžkou trvania.
+     *
+     * @tparam F typ funkcie
+     * @param count počet indexov
+     * @param body funkcia, ktorá dostane index a index vlákna
+     */
+    template<typename F>
+    void parallelForDynamic(int count, F&& body) {
+        std::atomic<int> next(0);
+        std::function<void(int)> job = [&](int thread) {
+            for (int index = next.fetch_add(1); index < count; index = next.fetch_add(1)) {
+                body(index, thread);
+            }
+        };
+        run(job);
+    }
+
+private:
+    /**
+     * Metóda workerLoop predstavuje cyklus pomocného vlákna: čaká na novú úlohu, vykoná ju a ohlási dokončenie.
+     *
+     * @param index index vlákna
+     */
+    void workerLoop(int index) {
+        unsigned int seenGeneration = 0;
+        while (true) {
+            // krátke aktívne čakanie na ďalšiu úlohu, potom uspanie
+            int spin = 0;
+            while (generation_.load(std::memory_order_acquire) == seenGeneration && !stop_.load(std::memory_order_acquire) && spin < SPIN_ITERATIONS) {
+                spin++;
+            }
+            if (generation_.load(std::memory_order_acquire) == seenGeneration && !stop_.load(std::memory_order_acquire)) {
+                std::unique_lock<std::mutex> lock(mutex_);
+                wakeUp_.wait(lock, [&] { return generation_.load(std::memory_order_acquire) != seenGeneration || stop_.load(std::memory_order_acquire); });
+            }
+            if (stop_.load(std::memory_order_acquire)) {
+                return;
+            }
+            seenGeneration = generation_.load(std::memory_order_acquire);
+            (*job_)(index);
+            remaining_.fetch_sub(1, std::memory_order_acq_rel);
+        }
+    }
+};
+
+#endif